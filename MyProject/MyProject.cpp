@@ -4,3 +4,39 @@
 #include "Modules/ModuleManager.h"
 
 IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, MyProject, "MyProject" );
+
+UE_TRACE_CHANNEL_DEFINE(MyProjectChannel);
+
+DEFINE_STAT(STAT_EnemyTick);
+DEFINE_STAT(STAT_EnemyUpdateAI);
+DEFINE_STAT(STAT_EnemyCheckCombatTarget);
+DEFINE_STAT(STAT_EnemySpawnSoul);
+DEFINE_STAT(STAT_WeaponSweepSwing);
+DEFINE_STAT(STAT_WeaponBoxTrace);
+DEFINE_STAT(STAT_WeaponOnBoxOverlap);
+DEFINE_STAT(STAT_BreakableSpawnLoot);
+DEFINE_STAT(STAT_HUDUpdate);
+DEFINE_STAT(STAT_SlashAnimUpdate);
+DEFINE_STAT(STAT_EnemyAnimUpdate);
+DEFINE_STAT(STAT_PoolAcquire);
+DEFINE_STAT(STAT_PoolRelease);
+DEFINE_STAT(STAT_GameplayTimers);
+DEFINE_STAT(STAT_ChaseFlowField);
+DEFINE_STAT(STAT_DamageResolve);
+DEFINE_STAT(STAT_EffectsFlush);
+DEFINE_STAT(STAT_LootRoll);
+
+DEFINE_STAT(STAT_WeaponHits);
+DEFINE_STAT(STAT_SoulsSpawned);
+DEFINE_STAT(STAT_LootSpawned);
+DEFINE_STAT(STAT_DamageHitsMerged);
+DEFINE_STAT(STAT_EffectsSpawned);
+DEFINE_STAT(STAT_EffectsCulled);
+
+DEFINE_STAT(STAT_LiveEnemies);
+DEFINE_STAT(STAT_LiveItems);
+DEFINE_STAT(STAT_PooledActors);
+
+TRACE_DECLARE_INT_COUNTER(MyProject_LiveEnemies, TEXT("MyProject/Live Enemies"));
+TRACE_DECLARE_INT_COUNTER(MyProject_LiveItems, TEXT("MyProject/Live Items"));
+TRACE_DECLARE_INT_COUNTER(MyProject_PooledActors, TEXT("MyProject/Pooled Actors"));
@@ -3,3 +3,63 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+/*
+	Profiling, shows up under "stat MyProject" and on the MyProject channel in Insights
+	(-trace=cpu,counters,MyProject)
+*/
+
+DECLARE_STATS_GROUP(TEXT("MyProject"), STATGROUP_MyProject, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(MyProjectChannel, MYPROJECT_API);
+
+//Cycle stat plus an Insights CPU scope of the same name
+#define MYPROJECT_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, MyProjectChannel)
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Tick"), STAT_EnemyTick, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy UpdateAI"), STAT_EnemyUpdateAI, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy CheckCombatTarget"), STAT_EnemyCheckCombatTarget, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy SpawnSoul"), STAT_EnemySpawnSoul, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Weapon SweepSwing"), STAT_WeaponSweepSwing, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Weapon BoxTrace"), STAT_WeaponBoxTrace, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Weapon OnBoxOverlap"), STAT_WeaponOnBoxOverlap, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Breakable SpawnLoot"), STAT_BreakableSpawnLoot, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Update"), STAT_HUDUpdate, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Slash Anim Update"), STAT_SlashAnimUpdate, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Anim Update"), STAT_EnemyAnimUpdate, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool Acquire"), STAT_PoolAcquire, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool Release"), STAT_PoolRelease, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gameplay Timers"), STAT_GameplayTimers, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Chase Flow Field"), STAT_ChaseFlowField, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Resolve"), STAT_DamageResolve, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Effects Flush"), STAT_EffectsFlush, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Loot Roll"), STAT_LootRoll, STATGROUP_MyProject, MYPROJECT_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Weapon Hits"), STAT_WeaponHits, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Souls Spawned"), STAT_SoulsSpawned, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Loot Spawned"), STAT_LootSpawned, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Hits Merged"), STAT_DamageHitsMerged, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effects Spawned"), STAT_EffectsSpawned, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effects Culled"), STAT_EffectsCulled, STATGROUP_MyProject, MYPROJECT_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Enemies"), STAT_LiveEnemies, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Items"), STAT_LiveItems, STATGROUP_MyProject, MYPROJECT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Actors"), STAT_PooledActors, STATGROUP_MyProject, MYPROJECT_API);
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(MyProject_LiveEnemies);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MyProject_LiveItems);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MyProject_PooledActors);
+
+//Keeps a live-count stat and its Insights counter in step
+#define MYPROJECT_INC_GAUGE(Name) \
+	INC_DWORD_STAT(STAT_##Name); \
+	TRACE_COUNTER_INCREMENT(MyProject_##Name)
+
+#define MYPROJECT_DEC_GAUGE(Name) \
+	DEC_DWORD_STAT(STAT_##Name); \
+	TRACE_COUNTER_DECREMENT(MyProject_##Name)
@@ -0,0 +1,149 @@
+#include "AI/ChaseFlowField.h"
+#include "NavigationData.h"
+
+namespace
+{
+	//Orthogonal steps then diagonals, opposites sit two apart within each group
+	const FIntPoint StepOffsets[8] =
+	{
+		FIntPoint(1, 0), FIntPoint(0, 1), FIntPoint(-1, 0), FIntPoint(0, -1),
+		FIntPoint(1, 1), FIntPoint(-1, 1), FIntPoint(-1, -1), FIntPoint(1, -1)
+	};
+
+	constexpr uint32 StepCosts[8] = { 10, 10, 10, 10, 14, 14, 14, 14 };
+
+	FORCEINLINE int32 OppositeStep(int32 Direction)
+	{
+		return Direction < 4 ? (Direction + 2) % 4 : 4 + (Direction - 2) % 4;
+	}
+}
+
+FChaseFlowField::FChaseFlowField(int32 InDimension, float InCellSize)
+	: Dimension(FMath::Max(InDimension, 2))
+	, CellSize(FMath::Max(InCellSize, 1.f))
+{
+	const int32 NumCells = Dimension * Dimension;
+	States.Init(ECellState::Unsampled, NumCells);
+	Costs.Init(Unreachable, NumCells);
+	Directions.Init(NoDirection, NumCells);
+	NumUnsampled = NumCells;
+}
+
+void FChaseFlowField::Recenter(const FVector& Location)
+{
+	const FIntPoint NewOrigin = GetCell(Location) - FIntPoint(Dimension / 2, Dimension / 2);
+	if (NewOrigin == OriginCell) return;
+
+	TArray<ECellState> NewStates;
+	NewStates.Init(ECellState::Unsampled, States.Num());
+	NumUnsampled = 0;
+	for (int32 Y = 0; Y < Dimension; Y++)
+	{
+		for (int32 X = 0; X < Dimension; X++)
+		{
+			const int32 OldIndex = ToIndex(NewOrigin + FIntPoint(X, Y));
+			const int32 NewIndex = Y * Dimension + X;
+			if (OldIndex != INDEX_NONE)
+				NewStates[NewIndex] = States[OldIndex];
+			if (NewStates[NewIndex] == ECellState::Unsampled)
+				NumUnsampled++;
+		}
+	}
+
+	States = MoveTemp(NewStates);
+	OriginCell = NewOrigin;
+	SampleCursor = 0;
+	GoalIndex = INDEX_NONE;
+}
+
+int32 FChaseFlowField::SampleWalkability(const ANavigationData& NavData, float Height, const FVector& Extent, int32 MaxSamples)
+{
+	int32 NumSampled = 0;
+	const int32 NumCells = States.Num();
+	while (NumUnsampled > 0 && NumSampled < MaxSamples && SampleCursor < NumCells)
+	{
+		const int32 Index = SampleCursor++;
+		if (States[Index] != ECellState::Unsampled) continue;
+
+		const FVector CellCenter(
+			(OriginCell.X + Index % Dimension + 0.5f) * CellSize,
+			(OriginCell.Y + Index / Dimension + 0.5f) * CellSize,
+			Height);
+		FNavLocation NavLocation;
+		States[Index] = NavData.ProjectPoint(CellCenter, NavLocation, Extent) ? ECellState::Walkable : ECellState::Blocked;
+		NumUnsampled--;
+		NumSampled++;
+	}
+	return NumSampled;
+}
+
+bool FChaseFlowField::CanStep(int32 X, int32 Y, int32 Direction) const
+{
+	const FIntPoint& Offset = StepOffsets[Direction];
+	const int32 ToX = X + Offset.X;
+	const int32 ToY = Y + Offset.Y;
+	if (ToX < 0 || ToY < 0 || ToX >= Dimension || ToY >= Dimension) return false;
+	if (!IsPassable(ToY * Dimension + ToX)) return false;
+	if (Direction < 4) return true;
+
+	return IsPassable(Y * Dimension + ToX) && IsPassable(ToY * Dimension + X);
+}
+
+void FChaseFlowField::Integrate(const FVector& Goal)
+{
+	FMemory::Memset(Costs.GetData(), 0xFF, Costs.Num() * sizeof(uint32));
+	FMemory::Memset(Directions.GetData(), NoDirection, Directions.Num());
+
+	GoalLocation = Goal;
+	GoalIndex = ToIndex(GetCell(Goal));
+	if (GoalIndex == INDEX_NONE) return;
+
+	//Dijkstra outward from the goal, a cell's direction points back at the cell that reached it
+	Open.Reset();
+	Costs[GoalIndex] = 0;
+	Open.HeapPush({ 0, GoalIndex });
+	while (Open.Num() > 0)
+	{
+		FOpenCell Current;
+		Open.HeapPop(Current, EAllowShrinking::No);
+		if (Current.Cost != Costs[Current.Index]) continue;
+
+		const int32 X = Current.Index % Dimension;
+		const int32 Y = Current.Index / Dimension;
+		for (int32 Direction = 0; Direction < 8; Direction++)
+		{
+			if (!CanStep(X, Y, Direction)) continue;
+
+			const int32 Neighbour = (Y + StepOffsets[Direction].Y) * Dimension + X + StepOffsets[Direction].X;
+			const uint32 Cost = Current.Cost + StepCosts[Direction];
+			if (Cost >= Costs[Neighbour]) continue;
+
+			Costs[Neighbour] = Cost;
+			Directions[Neighbour] = static_cast<uint8>(OppositeStep(Direction));
+			Open.HeapPush({ Cost, Neighbour });
+		}
+	}
+}
+
+bool FChaseFlowField::Contains(const FVector& Location) const
+{
+	return ToIndex(GetCell(Location)) != INDEX_NONE;
+}
+
+bool FChaseFlowField::GetDirection(const FVector& Location, FVector& OutDirection) const
+{
+	const FIntPoint Cell = GetCell(Location);
+	const int32 Index = ToIndex(Cell);
+	if (Index == INDEX_NONE || GoalIndex == INDEX_NONE || Costs[Index] == Unreachable) return false;
+
+	//Aim at the centre of the next cell rather than along the raw step, it keeps chasers off corners
+	FVector Target = GoalLocation;
+	if (Index != GoalIndex)
+	{
+		const FIntPoint Next = Cell + StepOffsets[Directions[Index]];
+		Target = FVector((Next.X + 0.5f) * CellSize, (Next.Y + 0.5f) * CellSize, Location.Z);
+	}
+
+	OutDirection = FVector(Target.X - Location.X, Target.Y - Location.Y, 0.f);
+	return OutDirection.Normalize();
+}
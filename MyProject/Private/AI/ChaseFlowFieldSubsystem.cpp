@@ -0,0 +1,202 @@
+#include "AI/ChaseFlowFieldSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Enemy/Enemy.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+void UChaseFlowFieldSubsystem::Deinitialize()
+{
+	Chasers.Empty();
+	ChaserFields.Empty();
+	ChaserOnPath.Empty();
+	Fields.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UChaseFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UChaseFlowFieldSubsystem, STATGROUP_MyProject);
+}
+
+int32 UChaseFlowFieldSubsystem::FindOrAddField(AActor* Target)
+{
+	for (int32 i = 0; i < Fields.Num(); i++)
+	{
+		if (Fields[i].Target == Target) return i;
+	}
+
+	//A fresh field treats every cell as walkable so chasers can steer from it straight away
+	const FVector Goal = Target->GetActorLocation();
+	FTargetField& Entry = Fields.AddDefaulted_GetRef();
+	Entry.Target = Target;
+	Entry.Field = FChaseFlowField(FieldDimension, CellSize);
+	Entry.Field.Recenter(Goal);
+	Entry.Field.Integrate(Goal);
+	Entry.GoalCell = Entry.Field.GetCell(Goal);
+	return Fields.Num() - 1;
+}
+
+bool UChaseFlowFieldSubsystem::StartChase(AEnemy* Enemy, AActor* Target)
+{
+	if (Enemy == nullptr || Target == nullptr) return false;
+
+	const int32 FieldIndex = FindOrAddField(Target);
+	int32 Slot = Enemy->ChaseSlot;
+	if (Chasers.IsValidIndex(Slot))
+	{
+		Fields[ChaserFields[Slot]].NumChasers--;
+		ChaserFields[Slot] = FieldIndex;
+	}
+	else
+	{
+		Slot = Chasers.Add(Enemy);
+		ChaserFields.Add(FieldIndex);
+		ChaserOnPath.Add(false);
+		Enemy->ChaseSlot = Slot;
+	}
+	Fields[FieldIndex].NumChasers++;
+
+	FVector Direction;
+	ChaserOnPath[Slot] = !Fields[FieldIndex].Field.GetDirection(Enemy->GetActorLocation(), Direction);
+	return !ChaserOnPath[Slot];
+}
+
+void UChaseFlowFieldSubsystem::StopChase(AEnemy* Enemy)
+{
+	if (Enemy && Chasers.IsValidIndex(Enemy->ChaseSlot))
+		RemoveChaser(Enemy->ChaseSlot);
+}
+
+void UChaseFlowFieldSubsystem::RemoveChaser(int32 Slot)
+{
+	if (Chasers[Slot])
+		Chasers[Slot]->ChaseSlot = INDEX_NONE;
+	Fields[ChaserFields[Slot]].NumChasers--;
+
+	Chasers.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	ChaserFields.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	ChaserOnPath.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	if (Chasers.IsValidIndex(Slot) && Chasers[Slot])
+	{
+		Chasers[Slot]->ChaseSlot = Slot;
+	}
+}
+
+void UChaseFlowFieldSubsystem::RemoveField(int32 FieldIndex)
+{
+	for (int32 Slot = Chasers.Num() - 1; Slot >= 0; Slot--)
+	{
+		if (ChaserFields[Slot] == FieldIndex)
+			RemoveChaser(Slot);
+	}
+
+	const int32 LastIndex = Fields.Num() - 1;
+	Fields.RemoveAtSwap(FieldIndex, 1, EAllowShrinking::No);
+	if (FieldIndex == LastIndex) return;
+
+	for (int32& ChaserField : ChaserFields)
+	{
+		if (ChaserField == LastIndex)
+			ChaserField = FieldIndex;
+	}
+}
+
+void UChaseFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_ChaseFlowField);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	UpdateFields(DeltaTime);
+	SteerChasers();
+}
+
+void UChaseFlowFieldSubsystem::UpdateFields(float DeltaTime)
+{
+	const UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const ANavigationData* NavData = NavSystem ? NavSystem->GetDefaultNavDataInstance() : nullptr;
+	int32 SampleBudget = MaxSamplesPerTick;
+
+	for (int32 i = Fields.Num() - 1; i >= 0; i--)
+	{
+		FTargetField& Entry = Fields[i];
+		Entry.IdleTime = Entry.NumChasers > 0 ? 0.f : Entry.IdleTime + DeltaTime;
+
+		const AActor* Target = Entry.Target.Get();
+		if (Target == nullptr || Entry.IdleTime > FieldTimeout)
+		{
+			RemoveField(i);
+			continue;
+		}
+
+		const FVector Goal = Target->GetActorLocation();
+		const FIntPoint GoalCell = Entry.Field.GetCell(Goal);
+		const FIntPoint Drift = GoalCell - Entry.Field.GetCenterCell();
+		if (FMath::Max(FMath::Abs(Drift.X), FMath::Abs(Drift.Y)) > RecenterCells)
+		{
+			Entry.Field.Recenter(Goal);
+			Entry.bDirty = true;
+		}
+
+		if (NavData && SampleBudget > 0 && Entry.Field.HasUnsampledCells())
+		{
+			const int32 NumSampled = Entry.Field.SampleWalkability(*NavData, Goal.Z, ProjectionExtent, SampleBudget);
+			SampleBudget -= NumSampled;
+			Entry.bDirty |= NumSampled > 0;
+		}
+
+		if (Entry.bDirty || GoalCell != Entry.GoalCell)
+		{
+			Entry.Field.Integrate(Goal);
+			Entry.GoalCell = GoalCell;
+			Entry.bDirty = false;
+		}
+		else
+		{
+			Entry.Field.SetGoalLocation(Goal);
+		}
+	}
+}
+
+void UChaseFlowFieldSubsystem::SteerChasers()
+{
+	const double AcceptanceRadiusSquared = FMath::Square(AcceptanceRadius);
+
+	for (int32 Slot = Chasers.Num() - 1; Slot >= 0; Slot--)
+	{
+		AEnemy* Enemy = Chasers[Slot];
+		const FTargetField& Entry = Fields[ChaserFields[Slot]];
+		AActor* Target = Entry.Target.Get();
+
+		//Attacking enemies keep closing in, the same way their move request used to carry on
+		if (Enemy == nullptr || Target == nullptr || Enemy->CombatTarget != Target || !(Enemy->IsChasing() || Enemy->IsAttacking()))
+		{
+			RemoveChaser(Slot);
+			continue;
+		}
+
+		const FVector Location = Enemy->GetActorLocation();
+		if (FVector::DistSquared2D(Location, Target->GetActorLocation()) <= AcceptanceRadiusSquared) continue;
+
+		FVector Direction;
+		if (Entry.Field.GetDirection(Location, Direction))
+		{
+			if (ChaserOnPath[Slot])
+			{
+				if (Enemy->EnemyController)
+					Enemy->EnemyController->StopMovement();
+				ChaserOnPath[Slot] = false;
+			}
+			Enemy->AddMovementInput(Direction);
+		}
+		else if (!ChaserOnPath[Slot])
+		{
+			Enemy->MoveToTarget(Target);
+			ChaserOnPath[Slot] = true;
+		}
+	}
+}
@@ -0,0 +1,152 @@
+#include "AI/EnemyAISubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Enemy/Enemy.h"
+#include "GameFramework/PlayerController.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+void UEnemyAISubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	Locations.Empty();
+	NextUpdateTimes.Empty();
+	DecisionIntervals.Empty();
+	Radii.Empty();
+	PendingRemovals = 0;
+	Super::Deinitialize();
+}
+
+TStatId UEnemyAISubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyAISubsystem, STATGROUP_MyProject);
+}
+
+void UEnemyAISubsystem::RegisterEnemy(AEnemy* Enemy)
+{
+	if (Enemy == nullptr || Enemy->AISlot != INDEX_NONE) return;
+
+	Enemy->AISlot = Enemies.Add(Enemy);
+	Locations.Add(Enemy->GetActorLocation());
+	NextUpdateTimes.Add(0.0);
+	DecisionIntervals.Add(0.f);
+	Radii.Add(Enemy->GetRangeRadii());
+}
+
+void UEnemyAISubsystem::UnregisterEnemy(AEnemy* Enemy)
+{
+	if (Enemy == nullptr || !Enemies.IsValidIndex(Enemy->AISlot)) return;
+
+	//Slots are compacted at the start of the next tick so indices stay stable during an update pass
+	Enemies[Enemy->AISlot] = nullptr;
+	Enemy->AISlot = INDEX_NONE;
+	PendingRemovals++;
+}
+
+void UEnemyAISubsystem::SetDecisionInterval(AEnemy* Enemy, float Interval)
+{
+	if (Enemy && DecisionIntervals.IsValidIndex(Enemy->AISlot))
+		DecisionIntervals[Enemy->AISlot] = Interval;
+}
+
+void UEnemyAISubsystem::SetRangeRadii(AEnemy* Enemy, const FEnemyRangeRadii& InRadii)
+{
+	if (Enemy && Radii.IsValidIndex(Enemy->AISlot))
+		Radii[Enemy->AISlot] = InRadii;
+}
+
+void UEnemyAISubsystem::CompactSlots()
+{
+	for (int32 i = Enemies.Num() - 1; i >= 0; i--)
+	{
+		if (Enemies[i]) continue;
+
+		Enemies.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		Locations.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		NextUpdateTimes.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		DecisionIntervals.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		Radii.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		if (Enemies.IsValidIndex(i))
+		{
+			Enemies[i]->AISlot = i;
+		}
+	}
+	PendingRemovals = 0;
+}
+
+float UEnemyAISubsystem::GetUpdateInterval(double DistanceSquared) const
+{
+	if (DistanceSquared <= FMath::Square(NearDistance)) return 0.f;
+	if (DistanceSquared <= FMath::Square(FarDistance)) return MidUpdateInterval;
+	return FarUpdateInterval;
+}
+
+bool UEnemyAISubsystem::GetFocusLocation(FVector& OutLocation) const
+{
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (PlayerController && PlayerController->GetPawn())
+	{
+		OutLocation = PlayerController->GetPawn()->GetActorLocation();
+		return true;
+	}
+	return false;
+}
+
+void UEnemyAISubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	if (PendingRemovals > 0) CompactSlots();
+
+	const int32 NumEnemies = Enemies.Num();
+	if (NumEnemies == 0) return;
+
+	FVector FocusLocation;
+	const bool bHasFocus = GetFocusLocation(FocusLocation);
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	//Round-robin from where the last frame stopped so a full budget can't starve the tail of the array
+	DueSlots.Reset();
+	UpdateCursor = UpdateCursor % NumEnemies;
+	for (int32 Visited = 0; Visited < NumEnemies && DueSlots.Num() < MaxUpdatesPerFrame; Visited++)
+	{
+		const int32 Slot = UpdateCursor;
+		UpdateCursor = (UpdateCursor + 1) % NumEnemies;
+
+		if (Now >= NextUpdateTimes[Slot]) DueSlots.Add(Slot);
+	}
+
+	const int32 NumDue = DueSlots.Num();
+	DueLocations.SetNumUninitialized(NumDue, EAllowShrinking::No);
+	DueTargets.SetNumUninitialized(NumDue, EAllowShrinking::No);
+	DueRadii.SetNumUninitialized(NumDue, EAllowShrinking::No);
+	DueBands.SetNumUninitialized(NumDue, EAllowShrinking::No);
+
+	for (int32 i = 0; i < NumDue; i++)
+	{
+		const int32 Slot = DueSlots[i];
+		const AEnemy* Enemy = Enemies[Slot];
+		const AActor* Target = Enemy->GetAITarget();
+
+		Locations[Slot] = Enemy->GetActorLocation();
+		DueLocations[i] = Locations[Slot];
+		DueTargets[i] = Target ? Target->GetActorLocation() : Locations[Slot];
+		//Default radii never match, so a missing target classifies as out of range
+		DueRadii[i] = Target ? Radii[Slot] : FEnemyRangeRadii();
+
+		const double DistanceSquared = bHasFocus ? FVector::DistSquared(Locations[Slot], FocusLocation) : 0.0;
+		NextUpdateTimes[Slot] = Now + FMath::Max(GetUpdateInterval(DistanceSquared), DecisionIntervals[Slot]);
+	}
+
+	FEnemyRangeClassifier::ClassifyBatch(DueLocations, DueTargets, DueRadii, DueBands);
+
+	for (int32 i = 0; i < NumDue; i++)
+	{
+		//An earlier update in this pass can unregister an enemy
+		if (AEnemy* Enemy = Enemies[DueSlots[i]])
+		{
+			Enemy->UpdateAI(DueBands[i]);
+		}
+	}
+}
@@ -0,0 +1,236 @@
+#include "AI/EnemyPerceptionSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Enemy/Enemy.h"
+#include "GameFramework/Pawn.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+void UEnemyPerceptionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	PawnHash = FPawnSpatialHash(CellSize);
+	SightTraceDelegate.BindUObject(this, &UEnemyPerceptionSubsystem::OnSightTraceDone);
+}
+
+void UEnemyPerceptionSubsystem::Deinitialize()
+{
+	Pawns.Empty();
+	PawnLocations.Empty();
+	Observers.Empty();
+	SightRadii.Empty();
+	CosHalfAngles.Empty();
+	NextSenseTimes.Empty();
+	PendingQueries.Empty();
+	PendingHead = 0;
+	OutstandingQueries.Empty();
+	InFlightQueries.Empty();
+	VisibleResults.Empty();
+	SightTraceDelegate.Unbind();
+	PawnHash.Reset();
+	Super::Deinitialize();
+}
+
+TStatId UEnemyPerceptionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPerceptionSubsystem, STATGROUP_MyProject);
+}
+
+void UEnemyPerceptionSubsystem::RegisterPawn(APawn* Pawn)
+{
+	if (Pawn)
+		Pawns.AddUnique(Pawn);
+}
+
+void UEnemyPerceptionSubsystem::UnregisterPawn(APawn* Pawn)
+{
+	Pawns.RemoveSingleSwap(Pawn);
+}
+
+void UEnemyPerceptionSubsystem::RegisterObserver(AEnemy* Observer, float SightRadius, float PeripheralVisionAngle)
+{
+	if (Observer == nullptr || Observer->PerceptionSlot != INDEX_NONE) return;
+
+	Observer->PerceptionSlot = Observers.Add(Observer);
+	SightRadii.Add(SightRadius);
+	CosHalfAngles.Add(FMath::Cos(FMath::DegreesToRadians(PeripheralVisionAngle)));
+	//Stagger first checks so enemies spawned together don't all sense on the same frame
+	NextSenseTimes.Add(GetWorld()->GetTimeSeconds() + FMath::FRand() * SensingInterval);
+}
+
+void UEnemyPerceptionSubsystem::UnregisterObserver(AEnemy* Observer)
+{
+	if (Observer == nullptr || !Observers.IsValidIndex(Observer->PerceptionSlot)) return;
+
+	const int32 Index = Observer->PerceptionSlot;
+	Observer->PerceptionSlot = INDEX_NONE;
+	Observers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	SightRadii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	CosHalfAngles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	NextSenseTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Observers.IsValidIndex(Index) && Observers[Index])
+	{
+		Observers[Index]->PerceptionSlot = Index;
+	}
+}
+
+void UEnemyPerceptionSubsystem::SetObserverSensing(AEnemy* Observer, bool bEnabled)
+{
+	if (Observer == nullptr || !Observers.IsValidIndex(Observer->PerceptionSlot)) return;
+
+	const int32 Index = Observer->PerceptionSlot;
+	NextSenseTimes[Index] = bEnabled
+		? GetWorld()->GetTimeSeconds() + FMath::FRand() * SensingInterval
+		: TNumericLimits<double>::Max();
+}
+
+void UEnemyPerceptionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	DeliverSightResults();
+
+	if (Observers.Num() == 0) return;
+
+	RebuildPawnHash();
+	if (PawnLocations.Num() > 0)
+	{
+		GatherSightQueries(GetWorld()->GetTimeSeconds());
+	}
+	SubmitSightTraces();
+}
+
+void UEnemyPerceptionSubsystem::RebuildPawnHash()
+{
+	PawnHash.Reset();
+	PawnLocations.Reset();
+
+	for (int32 i = Pawns.Num() - 1; i >= 0; i--)
+	{
+		if (Pawns[i] == nullptr)
+			Pawns.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	}
+	for (int32 i = 0; i < Pawns.Num(); i++)
+	{
+		PawnLocations.Add(Pawns[i]->GetActorLocation());
+		PawnHash.Add(i, PawnLocations[i]);
+	}
+}
+
+void UEnemyPerceptionSubsystem::GatherSightQueries(double Now)
+{
+	const int32 NumObservers = Observers.Num();
+	SenseCursor = SenseCursor % NumObservers;
+
+	int32 Sensed = 0;
+	for (int32 Visited = 0; Visited < NumObservers && Sensed < MaxObserversPerFrame; Visited++)
+	{
+		const int32 Index = SenseCursor;
+		SenseCursor = (SenseCursor + 1) % NumObservers;
+
+		AEnemy* Observer = Observers[Index];
+		if (Observer == nullptr || Now < NextSenseTimes[Index]) continue;
+
+		//Sensing again before the last traces resolve would only grow the queue when traces fall behind
+		if (OutstandingQueries.Contains(Observer)) continue;
+
+		NextSenseTimes[Index] = Now + SensingInterval;
+		Sensed++;
+
+		const FVector Location = Observer->GetActorLocation();
+		const FVector Forward = Observer->GetActorForwardVector();
+		const float SightRadius = SightRadii[Index];
+
+		NearbyPawns.Reset();
+		PawnHash.Query(Location, SightRadius, NearbyPawns);
+		for (const int32 PawnIndex : NearbyPawns)
+		{
+			const FVector ToPawn = PawnLocations[PawnIndex] - Location;
+			const double DistSquared = ToPawn.SizeSquared();
+			if (DistSquared > FMath::Square(SightRadius)) continue;
+
+			//Inside the cone when cos(angle) >= cos(half angle), compared without normalizing ToPawn
+			const double Dot = FVector::DotProduct(Forward, ToPawn);
+			const double CosHalfAngle = CosHalfAngles[Index];
+			const bool bInCone = CosHalfAngle >= 0.0
+				? Dot >= 0.0 && Dot * Dot >= CosHalfAngle * CosHalfAngle * DistSquared
+				: Dot >= 0.0 || Dot * Dot <= CosHalfAngle * CosHalfAngle * DistSquared;
+			if (!bInCone) continue;
+
+			PendingQueries.Add({ Observer, Pawns[PawnIndex] });
+			OutstandingQueries.FindOrAdd(Observer)++;
+		}
+	}
+}
+
+void UEnemyPerceptionSubsystem::SubmitSightTraces()
+{
+	const int32 NumTraces = FMath::Min(PendingQueries.Num() - PendingHead, MaxSightTracesPerFrame);
+	for (int32 i = PendingHead; i < PendingHead + NumTraces; i++)
+	{
+		const AEnemy* Observer = PendingQueries[i].Observer.Get();
+		const APawn* Pawn = PendingQueries[i].Pawn.Get();
+		if (Observer == nullptr || Pawn == nullptr)
+		{
+			ReleaseSightQuery(PendingQueries[i]);
+			continue;
+		}
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(EnemySight), false, Observer);
+		Params.AddIgnoredActor(Pawn);
+
+		const uint32 QueryId = NextQueryId++;
+		InFlightQueries.Add(QueryId, PendingQueries[i]);
+		GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Test, Observer->GetPawnViewLocation(), Pawn->GetActorLocation(),
+			ECollisionChannel::ECC_Visibility, Params, FCollisionResponseParams::DefaultResponseParam, &SightTraceDelegate, QueryId);
+	}
+	PendingHead += NumTraces;
+
+	if (PendingHead == PendingQueries.Num())
+	{
+		PendingQueries.Reset();
+		PendingHead = 0;
+	}
+	else if (PendingHead > PendingQueries.Num() / 2)
+	{
+		PendingQueries.RemoveAt(0, PendingHead, EAllowShrinking::No);
+		PendingHead = 0;
+	}
+}
+
+void UEnemyPerceptionSubsystem::ReleaseSightQuery(const FSightQuery& Query)
+{
+	int32* Outstanding = OutstandingQueries.Find(Query.Observer);
+	if (Outstanding && --(*Outstanding) <= 0)
+	{
+		OutstandingQueries.Remove(Query.Observer);
+	}
+}
+
+void UEnemyPerceptionSubsystem::OnSightTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	FSightQuery Query;
+	if (!InFlightQueries.RemoveAndCopyValue(Datum.UserData, Query)) return;
+	ReleaseSightQuery(Query);
+
+	//Test traces only report a result when something blocked the line
+	if (Datum.OutHits.Num() == 0)
+	{
+		VisibleResults.Add(Query);
+	}
+}
+
+void UEnemyPerceptionSubsystem::DeliverSightResults()
+{
+	for (const FSightQuery& Result : VisibleResults)
+	{
+		AEnemy* Observer = Result.Observer.Get();
+		APawn* Pawn = Result.Pawn.Get();
+		if (Observer && Pawn)
+		{
+			Observer->PawnSeen(Pawn);
+		}
+	}
+	VisibleResults.Reset();
+}
@@ -0,0 +1,80 @@
+#include "AI/EnemyRangeClassifier.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	FORCEINLINE EEnemyRangeBand BandFromMasks(int32 AttackMask, int32 CombatMask, int32 PatrolMask, int32 Lane)
+	{
+		const int32 Bit = 1 << Lane;
+		if (AttackMask & Bit) return EEnemyRangeBand::ERB_Attack;
+		if (CombatMask & Bit) return EEnemyRangeBand::ERB_Combat;
+		if (PatrolMask & Bit) return EEnemyRangeBand::ERB_Patrol;
+		return EEnemyRangeBand::ERB_OutOfRange;
+	}
+
+	//A TargetStride of 0 reads one shared target, 1 reads one target per enemy
+	void ClassifyLanes(TArrayView<const FVector> Locations, const FVector* Targets, int32 TargetStride,
+		TArrayView<const FEnemyRangeRadii> Radii, TArrayView<EEnemyRangeBand> OutBands)
+	{
+		const int32 Num = Locations.Num();
+		check(Radii.Num() >= Num && OutBands.Num() >= Num);
+
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const FVector& L0 = Locations[i];
+			const FVector& L1 = Locations[i + 1];
+			const FVector& L2 = Locations[i + 2];
+			const FVector& L3 = Locations[i + 3];
+			const FVector& T0 = Targets[i * TargetStride];
+			const FVector& T1 = Targets[(i + 1) * TargetStride];
+			const FVector& T2 = Targets[(i + 2) * TargetStride];
+			const FVector& T3 = Targets[(i + 3) * TargetStride];
+
+			const VectorRegister4Double DX = VectorSubtract(MakeVectorRegisterDouble(L0.X, L1.X, L2.X, L3.X), MakeVectorRegisterDouble(T0.X, T1.X, T2.X, T3.X));
+			const VectorRegister4Double DY = VectorSubtract(MakeVectorRegisterDouble(L0.Y, L1.Y, L2.Y, L3.Y), MakeVectorRegisterDouble(T0.Y, T1.Y, T2.Y, T3.Y));
+			const VectorRegister4Double DZ = VectorSubtract(MakeVectorRegisterDouble(L0.Z, L1.Z, L2.Z, L3.Z), MakeVectorRegisterDouble(T0.Z, T1.Z, T2.Z, T3.Z));
+			const VectorRegister4Double DistSquared = VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+
+			const VectorRegister4Double AttackSquared = MakeVectorRegisterDouble(Radii[i].AttackRadiusSquared, Radii[i + 1].AttackRadiusSquared, Radii[i + 2].AttackRadiusSquared, Radii[i + 3].AttackRadiusSquared);
+			const VectorRegister4Double CombatSquared = MakeVectorRegisterDouble(Radii[i].CombatRadiusSquared, Radii[i + 1].CombatRadiusSquared, Radii[i + 2].CombatRadiusSquared, Radii[i + 3].CombatRadiusSquared);
+			const VectorRegister4Double PatrolSquared = MakeVectorRegisterDouble(Radii[i].PatrolRadiusSquared, Radii[i + 1].PatrolRadiusSquared, Radii[i + 2].PatrolRadiusSquared, Radii[i + 3].PatrolRadiusSquared);
+
+			const int32 AttackMask = VectorMaskBits(VectorCompareLE(DistSquared, AttackSquared));
+			const int32 CombatMask = VectorMaskBits(VectorCompareLE(DistSquared, CombatSquared));
+			const int32 PatrolMask = VectorMaskBits(VectorCompareLE(DistSquared, PatrolSquared));
+
+			for (int32 Lane = 0; Lane < 4; Lane++)
+			{
+				OutBands[i + Lane] = BandFromMasks(AttackMask, CombatMask, PatrolMask, Lane);
+			}
+		}
+
+		for (; i < Num; i++)
+		{
+			OutBands[i] = FEnemyRangeClassifier::Classify(Locations[i], Targets[i * TargetStride], Radii[i]);
+		}
+	}
+}
+
+EEnemyRangeBand FEnemyRangeClassifier::Classify(const FVector& Location, const FVector& Target, const FEnemyRangeRadii& Radii)
+{
+	const double DistSquared = FVector::DistSquared(Location, Target);
+	if (DistSquared <= Radii.AttackRadiusSquared) return EEnemyRangeBand::ERB_Attack;
+	if (DistSquared <= Radii.CombatRadiusSquared) return EEnemyRangeBand::ERB_Combat;
+	if (DistSquared <= Radii.PatrolRadiusSquared) return EEnemyRangeBand::ERB_Patrol;
+	return EEnemyRangeBand::ERB_OutOfRange;
+}
+
+void FEnemyRangeClassifier::ClassifyBatch(TArrayView<const FVector> Locations, const FVector& Target,
+	TArrayView<const FEnemyRangeRadii> Radii, TArrayView<EEnemyRangeBand> OutBands)
+{
+	ClassifyLanes(Locations, &Target, 0, Radii, OutBands);
+}
+
+void FEnemyRangeClassifier::ClassifyBatch(TArrayView<const FVector> Locations, TArrayView<const FVector> Targets,
+	TArrayView<const FEnemyRangeRadii> Radii, TArrayView<EEnemyRangeBand> OutBands)
+{
+	check(Targets.Num() >= Locations.Num());
+	ClassifyLanes(Locations, Targets.GetData(), 1, Radii, OutBands);
+}
@@ -0,0 +1,132 @@
+#include "AI/EnemySignificanceSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Enemy/Enemy.h"
+#include "GameFramework/PlayerController.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+UEnemySignificanceSubsystem::UEnemySignificanceSubsystem()
+{
+	MediumSettings.ActorTickInterval = 0.05f;
+	MediumSettings.DecisionInterval = 0.05f;
+	MediumSettings.MeshTickInterval = 0.f;
+	MediumSettings.MovementTickInterval = 0.f;
+	MediumSettings.bTickPoseWhenHidden = false;
+
+	LowSettings.ActorTickInterval = 0.2f;
+	LowSettings.DecisionInterval = 0.2f;
+	LowSettings.MeshTickInterval = 0.1f;
+	LowSettings.MovementTickInterval = 0.1f;
+	LowSettings.bTickPoseWhenHidden = false;
+	LowSettings.bTickHealthWidget = false;
+
+	DormantSettings.ActorTickInterval = 0.5f;
+	DormantSettings.DecisionInterval = 0.5f;
+	DormantSettings.MeshTickInterval = 0.5f;
+	DormantSettings.MovementTickInterval = 0.25f;
+	DormantSettings.bTickPoseWhenHidden = false;
+	DormantSettings.bTickHealthWidget = false;
+	DormantSettings.bSense = false;
+}
+
+void UEnemySignificanceSubsystem::Deinitialize()
+{
+	Enemies.Empty();
+	Scores.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEnemySignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemySignificanceSubsystem, STATGROUP_MyProject);
+}
+
+void UEnemySignificanceSubsystem::RegisterEnemy(AEnemy* Enemy)
+{
+	if (Enemy)
+		Enemies.AddUnique(Enemy);
+}
+
+void UEnemySignificanceSubsystem::UnregisterEnemy(AEnemy* Enemy)
+{
+	Enemies.RemoveSingleSwap(Enemy, EAllowShrinking::No);
+}
+
+const FEnemySignificanceSettings& UEnemySignificanceSubsystem::GetSettings(EEnemySignificance Significance) const
+{
+	switch (Significance)
+	{
+	case EEnemySignificance::ESL_Medium:
+		return MediumSettings;
+	case EEnemySignificance::ESL_Low:
+		return LowSettings;
+	case EEnemySignificance::ESL_Dormant:
+		return DormantSettings;
+	default:
+		return HighSettings;
+	}
+}
+
+void UEnemySignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	TimeUntilEvaluate -= DeltaTime;
+	if (TimeUntilEvaluate > 0.f) return;
+	TimeUntilEvaluate = EvaluationInterval;
+
+	Evaluate();
+}
+
+void UEnemySignificanceSubsystem::Evaluate()
+{
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	const APawn* Player = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if (Player == nullptr) return;
+
+	const FVector FocusLocation = Player->GetActorLocation();
+	const double OffscreenScaleSquared = FMath::Square(OffscreenDistanceScale);
+
+	Scores.Reset();
+	for (int32 i = 0; i < Enemies.Num(); i++)
+	{
+		const AEnemy* Enemy = Enemies[i];
+		if (Enemy == nullptr) continue;
+
+		double DistanceSquared = FVector::DistSquared(Enemy->GetActorLocation(), FocusLocation);
+		if (!Enemy->WasRecentlyRendered(RenderedTimeout))
+			DistanceSquared *= OffscreenScaleSquared;
+		Scores.Add({ DistanceSquared, i });
+	}
+	Scores.Sort([](const FSignificanceScore& A, const FSignificanceScore& B) { return A.DistanceSquared < B.DistanceSquared; });
+
+	const double HighDistanceSquared = FMath::Square(HighDistance);
+	const double MediumDistanceSquared = FMath::Square(MediumDistance);
+	const double LowDistanceSquared = FMath::Square(LowDistance);
+	int32 NumHigh = 0;
+	int32 NumMedium = 0;
+	for (const FSignificanceScore& Score : Scores)
+	{
+		EEnemySignificance Significance = EEnemySignificance::ESL_Dormant;
+		if (Score.DistanceSquared <= HighDistanceSquared && NumHigh < MaxHighEnemies)
+		{
+			Significance = EEnemySignificance::ESL_High;
+			NumHigh++;
+		}
+		else if (Score.DistanceSquared <= MediumDistanceSquared && NumMedium < MaxMediumEnemies)
+		{
+			Significance = EEnemySignificance::ESL_Medium;
+			NumMedium++;
+		}
+		else if (Score.DistanceSquared <= LowDistanceSquared)
+		{
+			Significance = EEnemySignificance::ESL_Low;
+		}
+
+		AEnemy* Enemy = Enemies[Score.Index];
+		if (Enemy->GetSignificance() != Significance)
+			Enemy->SetSignificance(Significance, GetSettings(Significance));
+	}
+}
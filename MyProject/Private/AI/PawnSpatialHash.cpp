@@ -0,0 +1,49 @@
+#include "AI/PawnSpatialHash.h"
+
+void FPawnSpatialHash::Reset()
+{
+	//Pawns mostly stay in the same cells between frames, so only drop cells that were already empty
+	for (auto It = Cells.CreateIterator(); It; ++It)
+	{
+		if (It.Value().IsEmpty())
+			It.RemoveCurrent();
+		else
+			It.Value().Reset();
+	}
+}
+
+void FPawnSpatialHash::Add(int32 Index, const FVector& Location)
+{
+	Cells.FindOrAdd(GetCell(Location)).Add(Index);
+}
+
+void FPawnSpatialHash::Query(const FVector& Center, float Radius, TArray<int32>& OutIndices) const
+{
+	const FIntPoint Min = GetCell(Center - FVector(Radius, Radius, 0.f));
+	const FIntPoint Max = GetCell(Center + FVector(Radius, Radius, 0.f));
+
+	//Walk whichever is smaller, the covered cells or the occupied ones
+	const int64 NumCovered = int64(Max.X - Min.X + 1) * int64(Max.Y - Min.Y + 1);
+	if (NumCovered > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<int32, TInlineAllocator<4>>>& Cell : Cells)
+		{
+			if (Cell.Key.X >= Min.X && Cell.Key.X <= Max.X && Cell.Key.Y >= Min.Y && Cell.Key.Y <= Max.Y)
+			{
+				OutIndices.Append(Cell.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 X = Min.X; X <= Max.X; X++)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+		{
+			if (const TArray<int32, TInlineAllocator<4>>* Cell = Cells.Find(FIntPoint(X, Y)))
+			{
+				OutIndices.Append(*Cell);
+			}
+		}
+	}
+}
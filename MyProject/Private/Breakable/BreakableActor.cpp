@@ -1,6 +1,7 @@
 #include "Breakable/BreakableActor.h"
+#include "MyProject/MyProject.h"
 #include "GeometryCollection/GeometryCollectionComponent.h"
-#include "Items/Treasure.h"
+#include "Items/LootSubsystem.h"
 #include "Components/CapsuleComponent.h"
 
 // Sets default values
@@ -24,6 +25,11 @@ void ABreakableActor::BeginPlay()
 {
 	Super::BeginPlay();
 	GeometryCollection->OnChaosBreakEvent.AddDynamic(this, &ABreakableActor::OnChaosBreakEvent);
+
+	if (LootSeed != 0)
+		LootStream.Initialize(LootSeed);
+	else
+		LootStream.GenerateNewSeed();
 }
 
 void ABreakableActor::OnChaosBreakEvent(const FChaosBreakEvent& BreakEvent)
@@ -32,56 +38,28 @@ void ABreakableActor::OnChaosBreakEvent(const FChaosBreakEvent& BreakEvent)
 	SpawnLoot();
 }
 
-int32 ABreakableActor::DetermineDrop()
-{
-	float TotalRate = 0;
-	for (TSubclassOf<ATreasure> Treasure : TreasureClasses)
-	{
-		//Getting pointer to Items in the array
-		ATreasure* IterItem = Treasure.GetDefaultObject();
-		if (IterItem->GetDropRate())
-		{
-			//Sum total drop chances
-			TotalRate += IterItem->GetDropRate();
-		}
-	}
-	
-	float DiceRoll = FMath::FRand() * TotalRate;
-	
-	for (size_t i = 0; i < TreasureClasses.Num(); i++)
-	{
-		//Getting pointer to Items in the array
-		ATreasure* IterItem = TreasureClasses[i].GetDefaultObject();
-		const float DropRate = IterItem->GetDropRate();
-		
-		if (DiceRoll < DropRate)
-		{
-			return i;
-		}
-		DiceRoll -= DropRate;
-	}
-	return 0;
-}
-
 void ABreakableActor::PlayBreakSound()
 {
 }
 
 void ABreakableActor::SpawnLoot()
 {
-	UWorld* World = GetWorld();
-	if (World && TreasureClasses.Num() > 0)
-	{
-		FVector Location = GetActorLocation();
-		Location.Z += 75.f;
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_BreakableSpawnLoot);
 
-		int32 Selection = DetermineDrop();
+	//Broken whatever the roll gives, so later break events can't roll again
+	Capsule->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
+	bIsBroken = true;
+	SetLifeSpan(3.f);
 
-		World->SpawnActor<ATreasure>(TreasureClasses[Selection], Location, GetActorRotation());
-		Capsule->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
-		bIsBroken = true;
-		SetLifeSpan(3.f);
-	}
+	UWorld* World = GetWorld();
+	ULootSubsystem* Loot = World ? World->GetSubsystem<ULootSubsystem>() : nullptr;
+	if (Loot == nullptr) return;
+
+	//Rolled with every other break this frame, a chain reaction costs one bulk roll per table
+	ULootTable* Table = LootTable ? LootTable.Get() : Loot->GetFallbackTable(TreasureClasses);
+	FVector Location = GetActorLocation();
+	Location.Z += 75.f;
+	Loot->QueueLoot(Table, LootStream, FTransform(GetActorRotation(), Location));
 }
 
 void ABreakableActor::Tick(float DeltaTime)
@@ -90,6 +68,11 @@ void ABreakableActor::Tick(float DeltaTime)
 
 }
 
+EGameplayTypeFlags ABreakableActor::GetTypeFlags() const
+{
+	return bIsBroken ? EGameplayTypeFlags::EGTF_Breakable | EGameplayTypeFlags::EGTF_Dead : EGameplayTypeFlags::EGTF_Breakable;
+}
+
 void ABreakableActor::GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter)
 {
 	if (bIsBroken) return;
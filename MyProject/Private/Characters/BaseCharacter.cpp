@@ -1,9 +1,12 @@
 #include "Characters/BaseCharacter.h"
+#include "Characters/HitDirectionClassifier.h"
 #include "Items/Weapons/Weapon.h"
+#include "Items/Weapons/WeaponHitComponent.h"
 #include "Components/BoxComponent.h"
 #include "Components/AttributeComponent.h"
 #include "Components/CapsuleComponent.h"
-#include "Kismet/GameplayStatics.h"
+#include "Effects/EffectsBudgetSubsystem.h"
+#include "GameFramework/DamageType.h"
 
 ABaseCharacter::ABaseCharacter()
 {
@@ -14,7 +17,14 @@ ABaseCharacter::ABaseCharacter()
 void ABaseCharacter::BeginPlay()
 {
 	Super::BeginPlay();
-	
+	CacheMontageSections();
+}
+
+void ABaseCharacter::CacheMontageSections()
+{
+	AttackSections.Build(AttackMontage);
+	DodgeSections.Build(DodgeMontage);
+	DeathSections.Build(DeathMontage);
 }
 
 bool ABaseCharacter::IsDead()
@@ -33,11 +43,12 @@ void ABaseCharacter::Die()
 	GetMesh()->SetGenerateOverlapEvents(false);
 	DisableCapsule();
 	Tags.Add("Dead");
+	AddTypeFlags(EGameplayTypeFlags::EGTF_Dead);
 }
 
 void ABaseCharacter::Attack()
 {
-	if (CombatTarget && CombatTarget->ActorHasTag("Dead"))
+	if (CombatTarget && IGameplayTypeInterface::ActorHasAnyTypeFlags(CombatTarget, EGameplayTypeFlags::EGTF_Dead))
 	{
 		CombatTarget = nullptr;
 	}
@@ -53,6 +64,21 @@ void ABaseCharacter::HandleDamage(float Damage)
 		Attributes->ReceiveDamage(Damage);
 }
 
+bool ABaseCharacter::HasAnyTypeFlags(int32 Flags) const
+{
+	return (TypeFlags & Flags) != 0;
+}
+
+void ABaseCharacter::AddTypeFlags(EGameplayTypeFlags Flags)
+{
+	TypeFlags |= static_cast<int32>(Flags);
+}
+
+void ABaseCharacter::RemoveTypeFlags(EGameplayTypeFlags Flags)
+{
+	TypeFlags &= ~static_cast<int32>(Flags);
+}
+
 bool ABaseCharacter::IsAlive()
 {
 	return Attributes && Attributes->IsAlive();
@@ -64,55 +90,46 @@ void ABaseCharacter::AttackEnd()
 
 void ABaseCharacter::DirectionalHitReact(const FVector& ImpactPoint)
 {
-	const FVector ForwardVector = GetActorForwardVector();
-	//Lower Impact Point to Enemy Z
-	const FVector ImpactLower(ImpactPoint.X, ImpactPoint.Y, GetActorLocation().Z);
-	const FVector ToHit = (ImpactLower - GetActorLocation()).GetSafeNormal();
-
-	// Forward * Tohit = |Forward| |ToHit| * cos(theta)
-	// |Forward| = 1, |ToHit| = 1, Forward * ToHit = cos(theta)
-	const double CosTheta = FVector::DotProduct(ForwardVector, ToHit);
-	// ACos of cos(theta) to get theta
-	double Theta = FMath::Acos(CosTheta);
-	//convert from radians to degrees
-	Theta = FMath::RadiansToDegrees(Theta);
-	// If CrossProduct points down, theta is negative
-	const FVector CrossProd = FVector::CrossProduct(ForwardVector, ToHit);
-	if (CrossProd.Z < 0)
-	{
-		Theta *= -1.f;
-	}
+	//Classified on the XY plane, so the impact height doesn't matter
+	PlayHitReactMontage(FHitDirectionClassifier::Classify(GetActorForwardVector(), ImpactPoint - GetActorLocation()));
+}
 
-	FName Section("FromBack");
-	if (Theta >= -45.f && Theta < 45.f)
-	{
-		Section = FName("FromFront");
-	}
-	else if (Theta >= -135.f && Theta < -45.f)
-	{
-		Section = FName("FromLeft");
-	}
-	else if (Theta >= 45.f && Theta < 135.f)
+void ABaseCharacter::ApplyHitReactions(TConstArrayView<ABaseCharacter*> Characters, const FVector& ImpactPoint)
+{
+	TArray<ABaseCharacter*, TInlineAllocator<32>> Reacting;
+	TArray<FVector, TInlineAllocator<32>> Forwards;
+	TArray<FVector, TInlineAllocator<32>> ToHits;
+	for (ABaseCharacter* Character : Characters)
 	{
-		Section = FName("FromRight");
+		if (Character == nullptr || !Character->IsAlive()) continue;
+
+		Reacting.Add(Character);
+		Forwards.Add(Character->GetActorForwardVector());
+		ToHits.Add(ImpactPoint - Character->GetActorLocation());
 	}
 
-	PlayHitReactMontage(Section);
+	TArray<EHitDirection, TInlineAllocator<32>> Directions;
+	Directions.SetNumUninitialized(Reacting.Num());
+	FHitDirectionClassifier::ClassifyBatch(Forwards, ToHits, Directions);
 
+	for (int32 i = 0; i < Reacting.Num(); i++)
+	{
+		Reacting[i]->PlayHitReactMontage(Directions[i]);
+	}
 }
 
 void ABaseCharacter::PlayHitSound(const FVector& ImpactPoint)
 {
 	if (HitSound)
-		UGameplayStatics::PlaySoundAtLocation(this, HitSound, ImpactPoint);
+		UEffectsBudgetSubsystem::PlaySound(this, HitSound, ImpactPoint);
 
 }
 
 void ABaseCharacter::SpawnHitParticles(const FVector& ImpactPoint)
 {
 
-	if (HitParticles && GetWorld())
-		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), HitParticles, ImpactPoint);
+	if (HitParticles)
+		UEffectsBudgetSubsystem::SpawnCascade(this, HitParticles, ImpactPoint);
 }
 
 void ABaseCharacter::DisableCapsule()
@@ -120,44 +137,43 @@ void ABaseCharacter::DisableCapsule()
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 }
 
-int32 ABaseCharacter::PlayRandomMontageSection(UAnimMontage* Montage, float PlayRate)
+int32 ABaseCharacter::PlayRandomMontageSection(UAnimMontage* Montage, const FMontageSectionTable& Sections, float PlayRate)
 {
 	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-	if (AnimInstance && Montage)
+	const int32 Section = Sections.PickRandom();
+	if (AnimInstance && Montage && Section != INDEX_NONE)
 	{
 		AnimInstance->Montage_Play(Montage, PlayRate);
-		const int32 Selection = FMath::RandRange(1, Montage->GetNumSections());
-		FName SectionName = Montage->GetSectionName(Selection - 1);
-		AnimInstance->Montage_JumpToSection(SectionName, Montage);
+		AnimInstance->Montage_JumpToSection(Sections.GetName(Section), Montage);
 
-		return Selection;
+		return Section + 1;
 	}
 	return 0;
 }
 
 void ABaseCharacter::PlayAttackMontage(float PlayRate)
 {
-	PlayRandomMontageSection(AttackMontage, PlayRate);
+	PlayRandomMontageSection(AttackMontage, AttackSections, PlayRate);
 }
 
 void ABaseCharacter::PlayDodgeMontage(float PlayRate)
 {
-	PlayRandomMontageSection(DodgeMontage, PlayRate);
+	PlayRandomMontageSection(DodgeMontage, DodgeSections, PlayRate);
 }
 
-void ABaseCharacter::PlayHitReactMontage(const FName& SectionName)
+void ABaseCharacter::PlayHitReactMontage(EHitDirection Direction)
 {
 	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
 	if (AnimInstance && HitReactMontage)
 	{
 		AnimInstance->Montage_Play(HitReactMontage, 1.5);
-		AnimInstance->Montage_JumpToSection(SectionName, HitReactMontage);
+		AnimInstance->Montage_JumpToSection(FHitDirectionClassifier::GetSectionName(Direction), HitReactMontage);
 	}
 }
 
 int32 ABaseCharacter::PlayDeathMontage()
 {
-	const int32 Selection = PlayRandomMontageSection(DeathMontage, 1);
+	const int32 Selection = PlayRandomMontageSection(DeathMontage, DeathSections, 1);
 	DeathPose = EDeathPose(Selection - 1);
 	return Selection;
 }
@@ -169,12 +185,23 @@ void ABaseCharacter::Tick(float DeltaTime)
 
 void ABaseCharacter::SetWeaponCollisionEnabled(ECollisionEnabled::Type CollisionEnabled)
 {
-	if (EquippedWeapon && EquippedWeapon->GetWeaponBox())
-	{
-		EquippedWeapon->GetWeaponBox()->SetCollisionEnabled(CollisionEnabled);
-		EquippedWeapon->IgnoreActors.Empty();
-	}
+	if (UWeaponHitComponent* WeaponHit = GetWeaponHitComponent())
+		WeaponHit->SetHitVolumeEnabled(CollisionEnabled);
+}
+
+UWeaponHitComponent* ABaseCharacter::GetWeaponHitComponent() const
+{
+	return EquippedWeapon ? EquippedWeapon->GetHitComponent() : nullptr;
+}
+
+void ABaseCharacter::ApplyResolvedDamage(float Damage, AController* EventInstigator, AActor* DamageCauser)
+{
+	HandleDamage(Damage);
 
+	//Resolved damage skips TakeDamage, keep AnyDamage listeners informed
+	const UDamageType* DamageType = GetDefault<UDamageType>();
+	ReceiveAnyDamage(Damage, DamageType, EventInstigator, DamageCauser);
+	OnTakeAnyDamage.Broadcast(this, Damage, DamageType, EventInstigator, DamageCauser);
 }
 
 void ABaseCharacter::GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter)
@@ -0,0 +1,35 @@
+#include "Characters/CharacterAnimInstanceProxy.h"
+#include "Characters/SlashCharacter.h"
+#include "Enemy/Enemy.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+void FCharacterAnimInstanceProxy::Initialize(UAnimInstance* InAnimInstance)
+{
+	FAnimInstanceProxy::Initialize(InAnimInstance);
+
+	Character = Cast<ABaseCharacter>(InAnimInstance->TryGetPawnOwner());
+	SlashCharacter = Cast<ASlashCharacter>(Character);
+	Enemy = Cast<AEnemy>(Character);
+	Movement = Character ? Character->GetCharacterMovement() : nullptr;
+}
+
+void FCharacterAnimInstanceProxy::PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds)
+{
+	FAnimInstanceProxy::PreUpdate(InAnimInstance, DeltaSeconds);
+
+	if (Movement == nullptr) return;
+
+	Velocity = Movement->Velocity;
+	bIsFalling = Movement->IsFalling();
+	DeathPose = Character->GetDeathPose();
+
+	if (SlashCharacter)
+	{
+		CharacterState = SlashCharacter->GetCharacterState();
+		ActionState = SlashCharacter->GetActionState();
+	}
+	if (Enemy)
+	{
+		EnemyState = Enemy->GetEnemyState();
+	}
+}
@@ -0,0 +1,40 @@
+#include "Characters/HitDirectionClassifier.h"
+
+namespace
+{
+	const FName HitReactSectionNames[] =
+	{
+		FName("FromFront"),
+		FName("FromLeft"),
+		FName("FromRight"),
+		FName("FromBack")
+	};
+	static_assert(UE_ARRAY_COUNT(HitReactSectionNames) == static_cast<int32>(EHitDirection::EHD_MAX), "Missing hit react section name");
+}
+
+EHitDirection FHitDirectionClassifier::Classify(const FVector& Forward, const FVector& ToHit)
+{
+	const double Dot = Forward.X * ToHit.X + Forward.Y * ToHit.Y;
+	const double Cross = Forward.X * ToHit.Y - Forward.Y * ToHit.X;
+
+	if (Dot >= FMath::Abs(Cross))
+		return EHitDirection::EHD_Front;
+	if (-Dot > FMath::Abs(Cross))
+		return EHitDirection::EHD_Back;
+	return Cross < 0.0 ? EHitDirection::EHD_Left : EHitDirection::EHD_Right;
+}
+
+void FHitDirectionClassifier::ClassifyBatch(TConstArrayView<FVector> Forwards, TConstArrayView<FVector> ToHits, TArrayView<EHitDirection> OutDirections)
+{
+	check(Forwards.Num() == ToHits.Num() && ToHits.Num() == OutDirections.Num());
+
+	for (int32 i = 0; i < OutDirections.Num(); i++)
+	{
+		OutDirections[i] = Classify(Forwards[i], ToHits[i]);
+	}
+}
+
+const FName& FHitDirectionClassifier::GetSectionName(EHitDirection Direction)
+{
+	return HitReactSectionNames[FMath::Min(static_cast<int32>(Direction), UE_ARRAY_COUNT(HitReactSectionNames) - 1)];
+}
@@ -2,9 +2,9 @@
 
 
 #include "Characters/SlashAnimInstance.h"
+#include "MyProject/MyProject.h"
 #include "Characters/SlashCharacter.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Kismet/KismetMathLibrary.h"
 
 void USlashAnimInstance::NativeInitializeAnimation()
 {
@@ -19,17 +19,15 @@ void USlashAnimInstance::NativeInitializeAnimation()
 	
 }
 
-void USlashAnimInstance::NativeUpdateAnimation(float DeltaTime)
+void USlashAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaTime)
 {
-	Super::NativeUpdateAnimation(DeltaTime);
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_SlashAnimUpdate);
 
-	if (SlashCharacterMovement)
-	{
-		GroundSpeed = UKismetMathLibrary::VSizeXY(SlashCharacterMovement->Velocity);
-		IsFalling = SlashCharacterMovement->IsFalling();
-		CharacterState = SlashCharacter->GetCharacterState();
-		ActionState = SlashCharacter->GetActionState();
-		DeathPose = SlashCharacter->GetDeathPose();
-	}
+	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
 
+	GroundSpeed = Proxy.Velocity.Size2D();
+	IsFalling = Proxy.bIsFalling;
+	CharacterState = Proxy.CharacterState;
+	ActionState = Proxy.ActionState;
+	DeathPose = Proxy.DeathPose;
 }
@@ -15,6 +15,7 @@
 #include "Items/Item.h"
 #include "Items/Soul.h"
 #include "Items/Treasure.h"
+#include "AI/EnemyPerceptionSubsystem.h"
 
 ASlashCharacter::ASlashCharacter()
 {
@@ -50,6 +51,8 @@ ASlashCharacter::ASlashCharacter()
 	Eyebrows->SetupAttachment(GetMesh());
 	Eyebrows->AttachmentName = FString("head");
 
+	TypeFlags = static_cast<int32>(EGameplayTypeFlags::EGTF_Player);
+
 
 }
 
@@ -69,11 +72,30 @@ void ASlashCharacter::BeginPlay()
 	}
 	
 	Tags.Add(FName("SlashCharacter"));
+	SetPerceivable(true);
+}
+
+void ASlashCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	SetPerceivable(false);
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASlashCharacter::SetPerceivable(bool bPerceivable)
+{
+	UEnemyPerceptionSubsystem* Perception = GetWorld() ? GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>() : nullptr;
+	if (Perception == nullptr) return;
+
+	if (bPerceivable)
+		Perception->RegisterPawn(this);
+	else
+		Perception->UnregisterPawn(this);
 }
 
 void ASlashCharacter::Die()
 {
 	Super::Die();
+	SetPerceivable(false);
 
 	ActionState = EActionState::EAS_Dead;
 }
@@ -86,10 +108,7 @@ void ASlashCharacter::InitializePlayerOverlay(APlayerController* PlayerControlle
 		PlayerOverlay = PlayerHUD->GetPlayerOverlay();
 		if (PlayerOverlay)
 		{
-			PlayerOverlay->SetHealthBarPercent(Attributes->GetHealthPercent());
-			PlayerOverlay->SetStaminaBarPercent(1.f);
-			PlayerOverlay->SetGold(0);
-			PlayerOverlay->SetSouls(0);
+			PlayerOverlay->BindToAttributes(Attributes);
 		}
 	}
 }
@@ -214,20 +233,11 @@ void ASlashCharacter::Dodge()
 	if (Attributes)
 	{
 		Attributes->UseStamina(Attributes->GetDodgeCost());
-		UpdateStaminaBar();
 		PlayDodgeMontage();
 		ActionState = EActionState::EAS_Dodging;
 	}
 }
 
-void ASlashCharacter::UpdateStaminaBar()
-{
-	if (Attributes && PlayerOverlay)
-	{
-		PlayerOverlay->SetStaminaBarPercent(Attributes->GetStaminaPercent());
-	}
-}
-
 void ASlashCharacter::EKeyPressed()	
 {
 	AWeapon* OverlappingWeapon = Cast<AWeapon>(OverlappingItem);
@@ -256,17 +266,6 @@ void ASlashCharacter::EKeyPressed()
 }
 
 
-void ASlashCharacter::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	if (Attributes)
-	{
-		Attributes->RegenStamina(DeltaTime);
-		UpdateStaminaBar();
-	}
-}
-
 void ASlashCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
 	Super::SetupPlayerInputComponent(PlayerInputComponent);
@@ -302,10 +301,15 @@ float ASlashCharacter::TakeDamage(float DamageAmount, FDamageEvent const& Damage
 {
 	if (IsDodging()) return 0.f;
 	HandleDamage(DamageAmount);
-	SetHUDHealth();
 	return DamageAmount;
 }
 
+void ASlashCharacter::ApplyResolvedDamage(float Damage, AController* EventInstigator, AActor* DamageCauser)
+{
+	if (IsDodging()) return;
+	Super::ApplyResolvedDamage(Damage, EventInstigator, DamageCauser);
+}
+
 void ASlashCharacter::SetOverlappingItem(AItem* Item)
 {
 	 OverlappingItem = Item; 
@@ -313,26 +317,16 @@ void ASlashCharacter::SetOverlappingItem(AItem* Item)
 
 void ASlashCharacter::AddSouls(ASoul* Soul)
 {
-	if (Attributes && PlayerOverlay)
+	if (Attributes)
 	{
 		Attributes->AddSouls(Soul->GetSouls());
-		PlayerOverlay->SetSouls(Attributes->GetSouls());
 	}
 }
 
 void ASlashCharacter::AddGold(ATreasure* Treasure)
 {
-	if (Attributes && PlayerOverlay)
+	if (Attributes)
 	{
 		Attributes->AddGold(Treasure->GetGold());
-		PlayerOverlay->SetGold(Attributes->GetGold());
-	}
-}
-
-void ASlashCharacter::SetHUDHealth()
-{
-	if (PlayerOverlay && Attributes)
-	{
-		PlayerOverlay->SetHealthBarPercent(Attributes->GetHealthPercent());
 	}
 }
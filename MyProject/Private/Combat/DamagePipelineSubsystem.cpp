@@ -0,0 +1,106 @@
+#include "Combat/DamagePipelineSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Interfaces/HitInterface.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+void UDamagePipelineSubsystem::Deinitialize()
+{
+	PendingHits.Empty();
+	ResolvingHits.Empty();
+	ResolvedHits.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UDamagePipelineSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDamagePipelineSubsystem, STATGROUP_MyProject);
+}
+
+void UDamagePipelineSubsystem::QueueHit(AActor* Target, AActor* Hitter, AController* Instigator, AActor* DamageCauser, const FVector& ImpactPoint, float Amount)
+{
+	if (Target == nullptr) return;
+
+	FHitRecord& Record = PendingHits.AddDefaulted_GetRef();
+	Record.Target = Target;
+	Record.Hitter = Hitter;
+	Record.Instigator = Instigator;
+	Record.DamageCauser = DamageCauser;
+	Record.ImpactPoint = ImpactPoint;
+	Record.Amount = Amount;
+	Record.Sequence = NextSequence++;
+}
+
+void UDamagePipelineSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	if (PendingHits.Num() > 0)
+		ResolveHits();
+}
+
+void UDamagePipelineSubsystem::ResolveHits()
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_DamageResolve);
+
+	Swap(PendingHits, ResolvingHits);
+	PendingHits.Reset();
+
+	//Group by target, then by causer, keeping queue order inside each group
+	ResolvingHits.Sort([](const FHitRecord& A, const FHitRecord& B)
+	{
+		const UPTRINT TargetA = reinterpret_cast<UPTRINT>(A.Target.Get());
+		const UPTRINT TargetB = reinterpret_cast<UPTRINT>(B.Target.Get());
+		if (TargetA != TargetB) return TargetA < TargetB;
+		const UPTRINT CauserA = reinterpret_cast<UPTRINT>(A.DamageCauser.Get());
+		const UPTRINT CauserB = reinterpret_cast<UPTRINT>(B.DamageCauser.Get());
+		if (CauserA != CauserB) return CauserA < CauserB;
+		return A.Sequence < B.Sequence;
+	});
+
+	ResolvedHits.Reset();
+	const FHitRecord* Previous = nullptr;
+	for (int32 i = 0; i < ResolvingHits.Num(); i++)
+	{
+		const FHitRecord& Hit = ResolvingHits[i];
+		if (!Hit.Target.IsValid()) continue;
+
+		const bool bSameTarget = Previous && Previous->Target == Hit.Target;
+		if (bSameTarget && Previous->DamageCauser == Hit.DamageCauser)
+		{
+			INC_DWORD_STAT(STAT_DamageHitsMerged);
+			continue;
+		}
+		Previous = &Hit;
+
+		if (!bSameTarget)
+		{
+			ResolvedHits.Add({ i, Hit.Amount, Hit.Sequence });
+			continue;
+		}
+
+		FResolvedHit& Resolved = ResolvedHits.Last();
+		Resolved.TotalAmount += Hit.Amount;
+		Resolved.FirstSequence = FMath::Min(Resolved.FirstSequence, Hit.Sequence);
+		if (Hit.Amount > ResolvingHits[Resolved.ReactionHit].Amount)
+			Resolved.ReactionHit = i;
+	}
+	ResolvedHits.Sort([](const FResolvedHit& A, const FResolvedHit& B) { return A.FirstSequence < B.FirstSequence; });
+
+	//All health changes land before any reaction, so whether a reaction sees a death doesn't depend on hit order
+	for (const FResolvedHit& Resolved : ResolvedHits)
+	{
+		const FHitRecord& Hit = ResolvingHits[Resolved.ReactionHit];
+		IHitInterface::DispatchDamage(Hit.Target.Get(), Resolved.TotalAmount, Hit.Instigator.Get(), Hit.DamageCauser.Get());
+	}
+
+	for (const FResolvedHit& Resolved : ResolvedHits)
+	{
+		const FHitRecord& Hit = ResolvingHits[Resolved.ReactionHit];
+		IHitInterface::DispatchReaction(Hit.Target.Get(), Hit.ImpactPoint, Hit.Hitter.Get(), Hit.Instigator.Get());
+	}
+
+	ResolvingHits.Reset();
+}
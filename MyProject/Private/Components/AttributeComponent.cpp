@@ -1,39 +1,149 @@
 #include "Components/AttributeComponent.h"
 
+namespace
+{
+	constexpr uint8 HealthAttribute = 1 << 0;
+	constexpr uint8 StaminaAttribute = 1 << 1;
+	constexpr uint8 GoldAttribute = 1 << 2;
+	constexpr uint8 SoulsAttribute = 1 << 3;
+}
+
 UAttributeComponent::UAttributeComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UAttributeComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
+	//Whatever listeners show at BeginPlay is the starting value, only later changes need events
+	LastBroadcastHealthPercent = GetHealthPercent();
+	SetStamina(Stamina);
+	LastBroadcastStaminaPercent = GetStaminaPercent();
+}
+
+double UAttributeComponent::GetWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+float UAttributeComponent::GetStamina() const
+{
+	if (Stamina >= MaxStamina || StaminaRegenRate <= 0.f) return Stamina;
+
+	const double Elapsed = GetWorldTime() - StaminaTimestamp;
+	return FMath::Min(Stamina + StaminaRegenRate * static_cast<float>(Elapsed), MaxStamina);
+}
+
+void UAttributeComponent::SetStamina(float NewStamina)
+{
+	Stamina = FMath::Clamp(NewStamina, 0.f, MaxStamina);
+	StaminaTimestamp = GetWorldTime();
+	UpdateRegenTimer();
+}
+
+void UAttributeComponent::UpdateRegenTimer()
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr) return;
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (Stamina >= MaxStamina || StaminaRegenRate <= 0.f)
+	{
+		TimerManager.ClearTimer(StaminaRegenTimer);
+	}
+	else
+	{
+		//Only the moment stamina fills up is an event, everything in between is read through GetStamina
+		const float TimeToFull = (MaxStamina - Stamina) / StaminaRegenRate;
+		TimerManager.SetTimer(StaminaRegenTimer, this, &UAttributeComponent::OnStaminaFull, FMath::Max(TimeToFull, 0.01f), false);
+	}
+}
+
+void UAttributeComponent::OnStaminaFull()
+{
+	SetStamina(MaxStamina);
+	MarkChanged(StaminaAttribute);
+}
+
+void UAttributeComponent::MarkChanged(uint8 Attribute)
+{
+	UWorld* World = GetWorld();
+	if (World && ChangedAttributes == 0)
+	{
+		World->GetTimerManager().SetTimerForNextTick(this, &UAttributeComponent::BroadcastChanges);
+	}
+	ChangedAttributes |= Attribute;
+}
+
+void UAttributeComponent::MarkPercentChanged(uint8 Attribute, float Percent, float LastBroadcastPercent)
+{
+	const bool bHitLimit = (Percent == 0.f || Percent == 1.f) && Percent != LastBroadcastPercent;
+	if (bHitLimit || FMath::Abs(Percent - LastBroadcastPercent) >= ChangeThreshold)
+	{
+		MarkChanged(Attribute);
+	}
+}
+
+void UAttributeComponent::BroadcastChanges()
+{
+	const uint8 Changed = ChangedAttributes;
+	ChangedAttributes = 0;
+
+	if (Changed & HealthAttribute)
+	{
+		LastBroadcastHealthPercent = GetHealthPercent();
+		OnHealthChanged.Broadcast(LastBroadcastHealthPercent);
+	}
+	if (Changed & StaminaAttribute)
+	{
+		LastBroadcastStaminaPercent = GetStaminaPercent();
+		OnStaminaChanged.Broadcast(LastBroadcastStaminaPercent);
+	}
+	if (Changed & GoldAttribute)
+	{
+		OnGoldChanged.Broadcast(Gold);
+	}
+	if (Changed & SoulsAttribute)
+	{
+		OnSoulsChanged.Broadcast(Souls);
+	}
 }
 
 void UAttributeComponent::AddSouls(int32 Amount)
 {
 	Souls += Amount;
+	MarkChanged(SoulsAttribute);
 }
 
 void UAttributeComponent::AddGold(int32 Amount)
 {
 	Gold += Amount;
+	MarkChanged(GoldAttribute);
 }
 
-void UAttributeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UAttributeComponent::ReceiveDamage(float Damage)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Health = FMath::Clamp(Health - Damage, 0.f, MaxHealth);
+	MarkPercentChanged(HealthAttribute, GetHealthPercent(), LastBroadcastHealthPercent);
 }
 
-void UAttributeComponent::RegenStamina(float DeltaTime)
+void UAttributeComponent::RestoreHealth()
 {
-	Stamina = FMath::Clamp(Stamina + StaminaRegenRate * DeltaTime, 0.f, MaxStamina);
+	Health = MaxHealth;
+	MarkPercentChanged(HealthAttribute, GetHealthPercent(), LastBroadcastHealthPercent);
 }
 
-void UAttributeComponent::ReceiveDamage(float Damage)
+void UAttributeComponent::SetMaxHealth(float NewMaxHealth)
 {
-	Health = FMath::Clamp(Health - Damage, 0.f, MaxHealth);
+	if (NewMaxHealth <= 0.f || NewMaxHealth == MaxHealth) return;
+
+	const float Percent = GetHealthPercent();
+	MaxHealth = NewMaxHealth;
+	Health = Percent * MaxHealth;
+	MarkPercentChanged(HealthAttribute, GetHealthPercent(), LastBroadcastHealthPercent);
 }
 
 float UAttributeComponent::GetHealthPercent()
@@ -43,7 +153,7 @@ float UAttributeComponent::GetHealthPercent()
 
 float UAttributeComponent::GetStaminaPercent()
 {
-	return Stamina / MaxStamina;
+	return GetStamina() / MaxStamina;
 }
 
 bool UAttributeComponent::IsAlive()
@@ -53,6 +163,7 @@ bool UAttributeComponent::IsAlive()
 
 void UAttributeComponent::UseStamina(float Cost)
 {
-	Stamina = FMath::Clamp(Stamina - Cost, 0.f, MaxStamina);
+	SetStamina(GetStamina() - Cost);
+	MarkPercentChanged(StaminaAttribute, GetStaminaPercent(), LastBroadcastStaminaPercent);
 }
 
@@ -0,0 +1,171 @@
+#include "Effects/EffectsBudgetSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+#include "Particles/ParticleSystem.h"
+#include "NiagaraSystem.h"
+#include "NiagaraFunctionLibrary.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+void UEffectsBudgetSubsystem::Deinitialize()
+{
+	PendingRequests.Empty();
+	SpawnedRequests.Empty();
+	LiveInstances.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UEffectsBudgetSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEffectsBudgetSubsystem, STATGROUP_MyProject);
+}
+
+void UEffectsBudgetSubsystem::RequestSound(USoundBase* Sound, const FVector& Location)
+{
+	QueueRequest(Sound, Location, EEffectType::Sound);
+}
+
+void UEffectsBudgetSubsystem::RequestCascade(UParticleSystem* System, const FVector& Location)
+{
+	QueueRequest(System, Location, EEffectType::Cascade);
+}
+
+void UEffectsBudgetSubsystem::RequestNiagara(UNiagaraSystem* System, const FVector& Location)
+{
+	QueueRequest(System, Location, EEffectType::Niagara);
+}
+
+void UEffectsBudgetSubsystem::QueueRequest(UObject* Asset, const FVector& Location, EEffectType Type)
+{
+	if (Asset)
+		PendingRequests.Add({ Asset, Location, Type });
+}
+
+void UEffectsBudgetSubsystem::PlaySound(const UObject* WorldContextObject, USoundBase* Sound, const FVector& Location)
+{
+	if (Sound == nullptr || WorldContextObject == nullptr) return;
+
+	UWorld* World = WorldContextObject->GetWorld();
+	if (UEffectsBudgetSubsystem* Effects = World ? World->GetSubsystem<UEffectsBudgetSubsystem>() : nullptr)
+		Effects->RequestSound(Sound, Location);
+	else
+		UGameplayStatics::PlaySoundAtLocation(WorldContextObject, Sound, Location);
+}
+
+void UEffectsBudgetSubsystem::SpawnCascade(const UObject* WorldContextObject, UParticleSystem* System, const FVector& Location)
+{
+	if (System == nullptr || WorldContextObject == nullptr) return;
+
+	UWorld* World = WorldContextObject->GetWorld();
+	if (UEffectsBudgetSubsystem* Effects = World ? World->GetSubsystem<UEffectsBudgetSubsystem>() : nullptr)
+		Effects->RequestCascade(System, Location);
+	else if (World)
+		UGameplayStatics::SpawnEmitterAtLocation(World, System, Location, FRotator::ZeroRotator, FVector(1.f), true, EPSCPoolMethod::AutoRelease);
+}
+
+void UEffectsBudgetSubsystem::SpawnNiagara(const UObject* WorldContextObject, UNiagaraSystem* System, const FVector& Location)
+{
+	if (System == nullptr || WorldContextObject == nullptr) return;
+
+	UWorld* World = WorldContextObject->GetWorld();
+	if (UEffectsBudgetSubsystem* Effects = World ? World->GetSubsystem<UEffectsBudgetSubsystem>() : nullptr)
+		Effects->RequestNiagara(System, Location);
+	else
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(WorldContextObject, System, Location, FRotator::ZeroRotator,
+			FVector(1.f), true, true, ENCPoolMethod::AutoRelease);
+}
+
+void UEffectsBudgetSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	if (PendingRequests.Num() > 0)
+		Flush();
+}
+
+void UEffectsBudgetSubsystem::Flush()
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_EffectsFlush);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	SpawnedRequests.Reset();
+
+	for (const FEffectRequest& Request : PendingRequests)
+	{
+		UObject* Asset = Request.Asset.Get();
+		if (Asset == nullptr) continue;
+
+		if (SpawnedRequests.Num() >= MaxSpawnsPerFrame || IsMerged(Request))
+		{
+			INC_DWORD_STAT(STAT_EffectsCulled);
+			continue;
+		}
+
+		FEffectInstances& Instances = LiveInstances.FindOrAdd(Request.Asset);
+		Instances.ExpireTimes.RemoveAllSwap([Now](double ExpireTime) { return ExpireTime <= Now; }, EAllowShrinking::No);
+		if (Instances.ExpireTimes.Num() >= GetMaxConcurrent(Asset))
+		{
+			INC_DWORD_STAT(STAT_EffectsCulled);
+			continue;
+		}
+
+		Instances.ExpireTimes.Add(Now + GetLifetime(Asset, Request.Type));
+		SpawnedRequests.Add(Request);
+		Spawn(Asset, Request.Location, Request.Type);
+		INC_DWORD_STAT(STAT_EffectsSpawned);
+	}
+	PendingRequests.Reset();
+}
+
+bool UEffectsBudgetSubsystem::IsMerged(const FEffectRequest& Request) const
+{
+	const double MergeRadiusSquared = FMath::Square(MergeRadius);
+	for (const FEffectRequest& Spawned : SpawnedRequests)
+	{
+		if (Spawned.Asset == Request.Asset && FVector::DistSquared(Spawned.Location, Request.Location) <= MergeRadiusSquared)
+			return true;
+	}
+	return false;
+}
+
+int32 UEffectsBudgetSubsystem::GetMaxConcurrent(const UObject* Asset) const
+{
+	if (ConcurrencyOverrides.Num() > 0)
+	{
+		if (const int32* Override = ConcurrencyOverrides.Find(FSoftObjectPath(Asset)))
+			return *Override;
+	}
+	return MaxConcurrentPerEffect;
+}
+
+float UEffectsBudgetSubsystem::GetLifetime(const UObject* Asset, EEffectType Type) const
+{
+	if (Type == EEffectType::Sound)
+	{
+		//Looping sounds report INDEFINITELY_LOOPING_DURATION
+		const float Duration = CastChecked<USoundBase>(Asset)->GetDuration();
+		return FMath::Clamp(Duration, 0.f, 10.f);
+	}
+	return EffectLifetime;
+}
+
+void UEffectsBudgetSubsystem::Spawn(UObject* Asset, const FVector& Location, EEffectType Type)
+{
+	switch (Type)
+	{
+	case EEffectType::Sound:
+		UGameplayStatics::PlaySoundAtLocation(this, CastChecked<USoundBase>(Asset), Location);
+		break;
+	case EEffectType::Cascade:
+		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), CastChecked<UParticleSystem>(Asset), Location, FRotator::ZeroRotator,
+			FVector(1.f), true, EPSCPoolMethod::AutoRelease);
+		break;
+	case EEffectType::Niagara:
+		UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, CastChecked<UNiagaraSystem>(Asset), Location, FRotator::ZeroRotator,
+			FVector(1.f), true, true, ENCPoolMethod::AutoRelease);
+		break;
+	}
+}
@@ -0,0 +1,74 @@
+#include "Enemy/CorpseSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Enemy/Enemy.h"
+#include "Pooling/ActorPoolSubsystem.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+void UCorpseSubsystem::Deinitialize()
+{
+	Corpses.Empty();
+	DeathTimes.Empty();
+	Settled.Empty();
+	Super::Deinitialize();
+}
+
+TStatId UCorpseSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCorpseSubsystem, STATGROUP_MyProject);
+}
+
+void UCorpseSubsystem::AddCorpse(AEnemy* Enemy)
+{
+	if (Enemy == nullptr || Corpses.Contains(Enemy)) return;
+
+	Enemy->StripForCorpse();
+	Corpses.Add(Enemy);
+	DeathTimes.Add(GetWorld()->GetTimeSeconds());
+	Settled.Add(false);
+
+	while (Corpses.Num() > FMath::Max(MaxCorpses, 0))
+	{
+		RecycleCorpse(0);
+	}
+}
+
+void UCorpseSubsystem::RecycleCorpse(int32 Index)
+{
+	AEnemy* Enemy = Corpses[Index];
+	Corpses.RemoveAt(Index, 1, EAllowShrinking::No);
+	DeathTimes.RemoveAt(Index, 1, EAllowShrinking::No);
+	Settled.RemoveAt(Index, 1, EAllowShrinking::No);
+	UActorPoolSubsystem::ReleaseOrDestroy(Enemy);
+}
+
+void UCorpseSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (int32 i = Corpses.Num() - 1; i >= 0; i--)
+	{
+		AEnemy* Enemy = Corpses[i];
+		if (!IsValid(Enemy))
+		{
+			Corpses.RemoveAt(i, 1, EAllowShrinking::No);
+			DeathTimes.RemoveAt(i, 1, EAllowShrinking::No);
+			Settled.RemoveAt(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const double Age = Now - DeathTimes[i];
+		if (CorpseLifetime > 0.f && Age >= CorpseLifetime)
+		{
+			RecycleCorpse(i);
+		}
+		else if (!Settled[i] && Age >= SettleTime)
+		{
+			Enemy->FreezeCorpsePose();
+			Settled[i] = true;
+		}
+	}
+}
@@ -1,7 +1,7 @@
 #include "Enemy/Enemy.h"
+#include "MyProject/MyProject.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Components/CapsuleComponent.h"
-#include "Perception/PawnSensingComponent.h"
 #include "Components/AttributeComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Navigation/PathFollowingComponent.h"
@@ -10,8 +10,19 @@
 #include "AIController.h"
 #include "NavigationData.h"
 #include "Items/Weapons/Weapon.h"
+#include "Items/Weapons/EnemyWeapon.h"
 #include "MyProject/DebugMacros.h"
 #include "Items/Soul.h"
+#include "AI/EnemyAISubsystem.h"
+#include "AI/EnemyPerceptionSubsystem.h"
+#include "AI/EnemySignificanceSubsystem.h"
+#include "AI/ChaseFlowFieldSubsystem.h"
+#include "Pooling/ActorPoolSubsystem.h"
+#include "Timers/GameplayTimerSubsystem.h"
+#include "Enemy/CorpseSubsystem.h"
+#include "Animation/AnimInstance.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEnemy, Log, All);
 
 AEnemy::AEnemy()
 {
@@ -21,6 +32,7 @@ AEnemy::AEnemy()
 	GetMesh()->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
 	GetMesh()->SetCollisionResponseToChannel(ECollisionChannel::ECC_Visibility, ECollisionResponse::ECR_Block);
 	GetMesh()->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);
+	GetMesh()->bEnableUpdateRateOptimizations = true;
 	GetCapsuleComponent()->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore);
 	
 	HealthWidget = CreateDefaultSubobject<UHealthBarComponent>(TEXT("HealthWidget"));
@@ -31,11 +43,8 @@ AEnemy::AEnemy()
 	bUseControllerRotationRoll = false;
 	bUseControllerRotationYaw = false;
 
-	PawnSensing = CreateDefaultSubobject<UPawnSensingComponent>(TEXT("PawnSensing"));
-	PawnSensing->SightRadius = 4000.f;
-	PawnSensing->SetPeripheralVisionAngle(90.f);
-
 	EnemyState = EEnemyState::EES_Idle;
+	TypeFlags = static_cast<int32>(EGameplayTypeFlags::EGTF_Enemy);
 }
 
 
@@ -43,37 +52,249 @@ void AEnemy::Die()
 {
 	Super::Die();
 	EnemyState = EEnemyState::EES_Dead;
+	UnregisterFromAIManager();
+	UnregisterFromPerception();
+	UnregisterFromSignificance();
+	StopFlowChase();
 	SpawnSoul();
 	ClearAttackTimer();
-	SetLifeSpan(5.f);
-	EquippedWeapon->SetLifeSpan(5.f);
+	if (UCorpseSubsystem* CorpseManager = GetWorld()->GetSubsystem<UCorpseSubsystem>())
+	{
+		CorpseManager->AddCorpse(this);
+	}
+	else
+	{
+		SetLifeSpan(5.f);
+		if (EquippedWeapon)
+			EquippedWeapon->DespawnAfter(5.f);
+		if (HeldWeapon)
+			HeldWeapon->SetLifeSpan(5.f);
+	}
 	RotateTowardsPlayer(false);
 	SetHealthBarVisibility(false);
 	GetCharacterMovement()->bOrientRotationToMovement = false;
 	OnDie();
 }
 
+void AEnemy::StripForCorpse()
+{
+	SetActorTickEnabled(false);
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->DisableMovement();
+	GetCharacterMovement()->SetComponentTickEnabled(false);
+	if (EnemyController)
+	{
+		EnemyController->StopMovement();
+		EnemyController->GetPathFollowingComponent()->SetComponentTickEnabled(false);
+	}
+	if (HealthWidget)
+		HealthWidget->SetComponentTickEnabled(false);
+}
+
+void AEnemy::FreezeCorpsePose()
+{
+	GetMesh()->SetComponentTickEnabled(false);
+}
+
+void AEnemy::OnReleasedToPool()
+{
+	UnregisterFromAIManager();
+	UnregisterFromPerception();
+	UnregisterFromSignificance();
+	StopFlowChase();
+	UnbindPatrolEvent();
+	ClearAttackTimer();
+	ClearPatrolTimer();
+
+	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+		AnimInstance->StopAllMontages(0.f);
+
+	//The pool only stops the actor tick, corpses pushed out before settling still tick their mesh and controller
+	StripForCorpse();
+	FreezeCorpsePose();
+
+	ReleaseWeapons();
+	CombatTarget = nullptr;
+
+	if (!bInPool)
+	{
+		bInPool = true;
+		MYPROJECT_DEC_GAUGE(LiveEnemies);
+	}
+}
+
+void AEnemy::ReleaseWeapons()
+{
+	if (EquippedWeapon)
+	{
+		UActorPoolSubsystem::ReleaseOrDestroy(EquippedWeapon);
+		EquippedWeapon = nullptr;
+	}
+	if (HeldWeapon)
+	{
+		UActorPoolSubsystem::ReleaseOrDestroy(HeldWeapon);
+		HeldWeapon = nullptr;
+	}
+}
+
+void AEnemy::OnAcquiredFromPool()
+{
+	bInPool = false;
+	MYPROJECT_INC_GAUGE(LiveEnemies);
+
+	Attributes->RestoreHealth();
+	if (HealthWidget)
+		HealthWidget->SetHealthPercent(1.f);
+	SetHealthBarVisibility(false);
+
+	EnemyState = EEnemyState::EES_Idle;
+	Tags.Remove(FName("Dead"));
+	RemoveTypeFlags(EGameplayTypeFlags::EGTF_Dead);
+
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	GetMesh()->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	GetMesh()->SetGenerateOverlapEvents(true);
+	GetMesh()->SetComponentTickEnabled(true);
+
+	GetCharacterMovement()->SetComponentTickEnabled(true);
+	GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Walking);
+	GetCharacterMovement()->bOrientRotationToMovement = true;
+	ApplyArchetype();
+	if (EnemyController)
+		EnemyController->GetPathFollowingComponent()->SetComponentTickEnabled(true);
+
+	RemainingPatrolTargets = PatrolTargets;
+	PatrolTarget = ChoosePatrolTarget();
+	SpawnDefaultWeapon();
+
+	RegisterWithAIManager();
+	RegisterWithPerception();
+	RegisterWithSignificance();
+}
+
+void AEnemy::SetArchetype(UEnemyArchetype* NewArchetype)
+{
+	Archetype = NewArchetype;
+	ApplyArchetype();
+
+	//Perception keeps its own copy of the sight values
+	if (!IsDead() && !bInPool)
+	{
+		UnregisterFromPerception();
+		RegisterWithPerception();
+	}
+}
+
+void AEnemy::ApplyArchetype()
+{
+	const UEnemyArchetype& Tuning = GetArchetype();
+	GetCharacterMovement()->MaxWalkSpeed = IsChasing() ? Tuning.GetChaseSpeed() : Tuning.GetPatrolSpeed();
+
+	if (AISlot != INDEX_NONE)
+	{
+		if (UEnemyAISubsystem* AIManager = GetWorld() ? GetWorld()->GetSubsystem<UEnemyAISubsystem>() : nullptr)
+			AIManager->SetRangeRadii(this, Tuning.GetRangeRadii());
+	}
+
+	if (Attributes && Tuning.GetMaxHealth() > 0.f)
+	{
+		Attributes->SetMaxHealth(Tuning.GetMaxHealth());
+		if (HealthWidget)
+			HealthWidget->SetHealthPercent(Attributes->GetHealthPercent());
+	}
+}
+
+void AEnemy::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	if (Archetype == nullptr && MigrateLegacyTuning())
+	{
+		UE_LOG(LogEnemy, Warning, TEXT("%s overrides enemy tuning that moved to UEnemyArchetype, using a generated archetype until an asset is assigned"), *GetPathName());
+	}
+#endif
+}
+
+#if WITH_EDITORONLY_DATA
+bool AEnemy::MigrateLegacyTuning()
+{
+	const UEnemyArchetype* Defaults = GetDefault<UEnemyArchetype>();
+	const bool bOverridden = AttackMin != Defaults->AttackMin || AttackMax != Defaults->AttackMax
+		|| CombatRadius != Defaults->CombatRadius || PatrolRadius != Defaults->PatrolRadius || AttackRadius != Defaults->AttackRadius
+		|| PatrolSpeed != Defaults->PatrolSpeed || ChaseSpeed != Defaults->ChaseSpeed
+		|| WaitMin != Defaults->WaitMin || WaitMax != Defaults->WaitMax
+		|| SightRadius != Defaults->SightRadius || PeripheralVisionAngle != Defaults->PeripheralVisionAngle;
+	if (!bOverridden) return false;
+
+	//One generated archetype per class, the CDO and every instance share it unless an instance overrides the class values
+	static TMap<TWeakObjectPtr<UClass>, TWeakObjectPtr<UEnemyArchetype>> GeneratedArchetypes;
+	if (UEnemyArchetype* Generated = GeneratedArchetypes.FindRef(GetClass()).Get())
+	{
+		if (AttackMin == Generated->AttackMin && AttackMax == Generated->AttackMax
+			&& static_cast<float>(CombatRadius) == Generated->CombatRadius && static_cast<float>(PatrolRadius) == Generated->PatrolRadius
+			&& static_cast<float>(AttackRadius) == Generated->AttackRadius
+			&& static_cast<float>(PatrolSpeed) == Generated->PatrolSpeed && static_cast<float>(ChaseSpeed) == Generated->ChaseSpeed
+			&& WaitMin == Generated->WaitMin && WaitMax == Generated->WaitMax
+			&& SightRadius == Generated->SightRadius && PeripheralVisionAngle == Generated->PeripheralVisionAngle)
+		{
+			Archetype = Generated;
+			return true;
+		}
+	}
+
+	//Transient so it is never saved, the legacy fields stay the source until an asset replaces them
+	UEnemyArchetype* Migrated = NewObject<UEnemyArchetype>(GetTransientPackage(), NAME_None, RF_Transient);
+	Migrated->AttackMin = AttackMin;
+	Migrated->AttackMax = AttackMax;
+	Migrated->CombatRadius = static_cast<float>(CombatRadius);
+	Migrated->PatrolRadius = static_cast<float>(PatrolRadius);
+	Migrated->AttackRadius = static_cast<float>(AttackRadius);
+	Migrated->PatrolSpeed = static_cast<float>(PatrolSpeed);
+	Migrated->ChaseSpeed = static_cast<float>(ChaseSpeed);
+	Migrated->WaitMin = WaitMin;
+	Migrated->WaitMax = WaitMax;
+	Migrated->SightRadius = SightRadius;
+	Migrated->PeripheralVisionAngle = PeripheralVisionAngle;
+	Migrated->RebuildCache();
+	Archetype = Migrated;
+
+	//The first load of a class is its CDO, instances with their own overrides don't replace the shared one
+	if (HasAnyFlags(RF_ClassDefaultObject) || !GeneratedArchetypes.FindRef(GetClass()).IsValid())
+		GeneratedArchetypes.Add(GetClass(), Migrated);
+	return true;
+}
+#endif
+
 void AEnemy::SpawnSoul()
 {
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_EnemySpawnSoul);
+
 	UWorld* World = GetWorld();
+	UActorPoolSubsystem* ActorPool = World ? World->GetSubsystem<UActorPoolSubsystem>() : nullptr;
 
-	if (World && SoulClass)
+	if (ActorPool && SoulClass)
 	{
 		const FVector SpawnLocation = GetActorLocation() + FVector(0.f, 0.f, 25.f);
-		ASoul* SpawnedSoul = World->SpawnActor<ASoul>(SoulClass, SpawnLocation, GetActorRotation());
+		ASoul* SpawnedSoul = ActorPool->Acquire<ASoul>(SoulClass, FTransform(GetActorRotation(), SpawnLocation));
 		if (SpawnedSoul)
 		{
+			INC_DWORD_STAT(STAT_SoulsSpawned);
 			SpawnedSoul->SetSouls(Attributes->GetSouls());
 			SpawnedSoul->UpdateNiagaraVariables();
 		}
 	}
 }
 
-bool AEnemy::InTargetRange(AActor* Target, double Radius)
+EEnemyRangeBand AEnemy::ClassifyTarget(AActor* Target) const
 {
-	if (Target == nullptr) return false;
-	const double Distance = (Target->GetActorLocation() - GetActorLocation()).Size();
-	return Distance <= Radius;
+	if (Target == nullptr) return EEnemyRangeBand::ERB_OutOfRange;
+	return FEnemyRangeClassifier::Classify(GetActorLocation(), Target->GetActorLocation(), GetRangeRadii());
+}
+
+AActor* AEnemy::GetAITarget() const
+{
+	return EnemyState > EEnemyState::EES_Patrolling ? CombatTarget : PatrolTarget;
 }
 
 
@@ -88,14 +309,66 @@ void AEnemy::SetHealthBarVisibility(bool Visible)
 {
 	if (HealthWidget)
 		HealthWidget->SetVisibility(Visible);
+	UpdateHealthWidgetTick();
+}
+
+void AEnemy::UpdateHealthWidgetTick()
+{
+	//Hidden bars never need to redraw, bars drawn by the HUD have no widget to redraw
+	if (HealthWidget)
+		HealthWidget->SetComponentTickEnabled(bTickHealthWidget && HealthWidget->IsVisible() && !HealthWidget->IsDrawnByHUD());
+}
+
+void AEnemy::SetSignificance(EEnemySignificance NewSignificance, const FEnemySignificanceSettings& Settings)
+{
+	Significance = NewSignificance;
+
+	SetActorTickInterval(Settings.ActorTickInterval);
+	GetMesh()->SetComponentTickInterval(Settings.MeshTickInterval);
+	GetMesh()->VisibilityBasedAnimTickOption = Settings.bTickPoseWhenHidden
+		? EVisibilityBasedAnimTickOption::AlwaysTickPose
+		: EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+	GetCharacterMovement()->SetComponentTickInterval(Settings.MovementTickInterval);
+
+	bTickHealthWidget = Settings.bTickHealthWidget;
+	UpdateHealthWidgetTick();
+
+	if (UEnemyPerceptionSubsystem* Perception = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>())
+	{
+		Perception->SetObserverSensing(this, Settings.bSense);
+	}
+	//The actor tick is off while the AI manager drives this enemy, so the bucket paces its decisions there
+	if (UEnemyAISubsystem* AIManager = GetWorld()->GetSubsystem<UEnemyAISubsystem>())
+	{
+		AIManager->SetDecisionInterval(this, Settings.DecisionInterval);
+	}
+}
+
+const FEnemySignificanceSettings* AEnemy::GetSignificanceSettings() const
+{
+	const UEnemySignificanceSubsystem* SignificanceSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UEnemySignificanceSubsystem>() : nullptr;
+	return SignificanceSubsystem ? &SignificanceSubsystem->GetSettings(Significance) : nullptr;
+}
+
+UWeaponHitComponent* AEnemy::GetWeaponHitComponent() const
+{
+	return HeldWeapon ? HeldWeapon->GetHitComponent() : Super::GetWeaponHitComponent();
 }
 
 void AEnemy::SpawnDefaultWeapon()
 {
 	UWorld* World = GetWorld();
-	if (World && WeaponClass)
+	UActorPoolSubsystem* ActorPool = World ? World->GetSubsystem<UActorPoolSubsystem>() : nullptr;
+	if (ActorPool && HeldWeaponClass)
 	{
-		AWeapon* DefaultWeapon = World->SpawnActor<AWeapon>(WeaponClass);
+		HeldWeapon = ActorPool->Acquire<AEnemyWeapon>(HeldWeaponClass, GetActorTransform());
+		if (HeldWeapon)
+			HeldWeapon->Equip(GetMesh(), FName("RHandSocket"), this, this);
+	}
+	else if (ActorPool && WeaponClass)
+	{
+		AWeapon* DefaultWeapon = ActorPool->Acquire<AWeapon>(WeaponClass, GetActorTransform());
+		if (DefaultWeapon == nullptr) return;
 		DefaultWeapon->Equip(GetMesh(), FName("RHandSocket"), this, this);
 		EquippedWeapon = DefaultWeapon;
 	}
@@ -122,12 +395,26 @@ float AEnemy::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AC
 		HealthWidget->SetHealthPercent(Attributes->GetHealthPercent());
 	}
 
-	CombatTarget = EventInstigator->GetPawn();
+	if (APawn* InstigatorPawn = EventInstigator ? EventInstigator->GetPawn() : nullptr)
+		CombatTarget = InstigatorPawn;
 	ChasePlayer();
 
 	return DamageAmount;
 }
 
+void AEnemy::ReceiveResolvedHit(const FVector& ImpactPoint, AActor* Hitter, AController* EventInstigator)
+{
+	if (HealthWidget)
+		HealthWidget->SetHealthPercent(Attributes->GetHealthPercent());
+
+	if (APawn* InstigatorPawn = EventInstigator ? EventInstigator->GetPawn() : nullptr)
+		CombatTarget = InstigatorPawn;
+	if (IsAlive())
+		ChasePlayer();
+
+	Execute_GetHit(this, ImpactPoint, Hitter);
+}
+
 void AEnemy::ChasePlayer()
 {
 	if (CombatTarget)
@@ -136,8 +423,11 @@ void AEnemy::ChasePlayer()
 		EnemyState = EEnemyState::EES_Chasing;
 		ClearAttackTimer();
 		ClearPatrolTimer();
-		GetCharacterMovement()->MaxWalkSpeed = ChaseSpeed;
-		MoveToTarget(CombatTarget);
+		GetCharacterMovement()->MaxWalkSpeed = GetArchetype().GetChaseSpeed();
+		if (!StartFlowChase())
+			MoveToTarget(CombatTarget);
+		else if (EnemyController)
+			EnemyController->StopMovement();
 	}
 }
 
@@ -159,7 +449,7 @@ void AEnemy::AttackEnd()
 	if (!IsDead())
 	{
 		EnemyState = EEnemyState::EES_Idle;
-		CheckCombatTarget();
+		CheckCombatTarget(ClassifyTarget(CombatTarget));
 	}
 }
 
@@ -172,14 +462,20 @@ void AEnemy::PlayAttackMontage(float PlayRate)
 void AEnemy::StartAttackTimer()
 {
 	EnemyState = EEnemyState::EES_Attacking;
-	const float AttackTime = FMath::RandRange(AttackMin, AttackMax);
-	GetWorldTimerManager().SetTimer(AttackTimer, this, &AEnemy::Attack, AttackTime);
+	const float AttackTime = GetArchetype().RandomAttackDelay();
+	if (UGameplayTimerSubsystem* Timers = GetGameplayTimers())
+	{
+		Timers->SetTimer(AttackTimer, this, &AEnemy::Attack, AttackTime);
+	}
 }
 
 
-void AEnemy::CheckCombatTarget()
+void AEnemy::CheckCombatTarget(EEnemyRangeBand CombatBand)
 {
-	if (!InTargetRange(CombatTarget, CombatRadius))
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_EnemyCheckCombatTarget);
+
+	const bool bInAttackRange = CombatBand == EEnemyRangeBand::ERB_Attack;
+	if (!FEnemyRangeClassifier::IsWithin(CombatBand, EEnemyRangeBand::ERB_Combat))
 	{
 		if (!IsEngaged())
 		{
@@ -187,14 +483,14 @@ void AEnemy::CheckCombatTarget()
 			BindPatrolEvent();
 		}
 	}
-	else if (!InTargetRange(CombatTarget, AttackRadius) && !IsChasing())
+	else if (!bInAttackRange && !IsChasing())
 	{
 		if (!IsEngaged()) ChasePlayer();
 	}
-	else if (InTargetRange(CombatTarget, AttackRadius) && !IsEngaged() && !IsDead())
+	else if (bInAttackRange && !IsEngaged() && !IsDead())
 	{
-		float Remain = GetWorldTimerManager().GetTimerRemaining(AttackTimer);
-		if (Remain > 0) return;
+		UGameplayTimerSubsystem* Timers = GetGameplayTimers();
+		if (Timers && Timers->IsTimerActive(AttackTimer)) return;
 		StartAttackTimer();
 	}
 }
@@ -202,12 +498,26 @@ void AEnemy::CheckCombatTarget()
 
 void AEnemy::ClearPatrolTimer()
 {
-	GetWorldTimerManager().ClearTimer(PatrolTimer);
+	if (UGameplayTimerSubsystem* Timers = GetGameplayTimers())
+	{
+		Timers->ClearTimer(PatrolTimer);
+	}
+	PatrolTimer.Invalidate();
 }
 
 void AEnemy::ClearAttackTimer()
 {
-	GetWorldTimerManager().ClearTimer(AttackTimer);
+	if (UGameplayTimerSubsystem* Timers = GetGameplayTimers())
+	{
+		Timers->ClearTimer(AttackTimer);
+	}
+	AttackTimer.Invalidate();
+}
+
+UGameplayTimerSubsystem* AEnemy::GetGameplayTimers() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetSubsystem<UGameplayTimerSubsystem>() : nullptr;
 }
 
 
@@ -239,11 +549,13 @@ void AEnemy::PawnSeen(APawn* SeenPawn)
 {
 	if (IsChasing() || IsDead() ) return;
 
-	if (SeenPawn->ActorHasTag("Dead")) return;
+	const EGameplayTypeFlags SeenFlags = IGameplayTypeInterface::GetActorTypeFlags(SeenPawn);
+	if (EnumHasAnyFlags(SeenFlags, EGameplayTypeFlags::EGTF_Dead)) return;
 
-	if (SeenPawn->ActorHasTag(FName("SlashCharacter")))
+	if (EnumHasAnyFlags(SeenFlags, EGameplayTypeFlags::EGTF_Player))
 	{
-		if (InTargetRange(SeenPawn, CombatRadius) && !IsAttacking() && !IsEngaged())
+		const bool bInCombatRange = FEnemyRangeClassifier::IsWithin(ClassifyTarget(SeenPawn), EEnemyRangeBand::ERB_Combat);
+		if (bInCombatRange && !IsAttacking() && !IsEngaged())
 		{
 			CombatTarget = SeenPawn;
 			ChasePlayer();
@@ -267,7 +579,10 @@ void AEnemy::OnMoveCompleted(FAIRequestID RequestID, const FPathFollowingResult&
 	EnemyState = EEnemyState::EES_Idle;
 	RemainingPatrolTargets.Remove(PatrolTarget);
 	UnbindPatrolEvent();
-	GetWorldTimerManager().SetTimer(PatrolTimer, this, &AEnemy::PatrolTimerFinished, 3.f);
+	if (UGameplayTimerSubsystem* Timers = GetGameplayTimers())
+	{
+		Timers->SetTimer(PatrolTimer, this, &AEnemy::PatrolTimerFinished, 3.f);
+	}
 }
 
 void AEnemy::MoveToTarget(AActor* Target)
@@ -285,32 +600,38 @@ AActor* AEnemy::ChoosePatrolTarget()
 	{
 		RemainingPatrolTargets = PatrolTargets;
 	}
+	//Spawned and pooled enemies may have no patrol route
+	if (RemainingPatrolTargets.Num() == 0) return nullptr;
 	const int32 NumPatrolTargets = RemainingPatrolTargets.Num();
 	const int32 Selection = FMath::RandRange(0, NumPatrolTargets - 1);
 	return RemainingPatrolTargets[Selection];
 }
 
-void AEnemy::CheckPatrolTarget()
+void AEnemy::CheckPatrolTarget(EEnemyRangeBand PatrolBand)
 {
 	if (EnemyState == EEnemyState::EES_Patrolling) return;
 
-	if (InTargetRange(PatrolTarget, PatrolRadius))
+	if (FEnemyRangeClassifier::IsWithin(PatrolBand, EEnemyRangeBand::ERB_Patrol))
 	{
 		EnemyState = EEnemyState::EES_Patrolling;
 		PatrolTarget = ChoosePatrolTarget();
-		const float WaitTime = FMath::RandRange(WaitMin, WaitMax);
+		const float WaitTime = GetArchetype().RandomPatrolWait();
 		BindPatrolEvent();
-		GetWorldTimerManager().SetTimer(PatrolTimer, this, &AEnemy::PatrolTimerFinished, WaitTime);
+		if (UGameplayTimerSubsystem* Timers = GetGameplayTimers())
+		{
+			Timers->SetTimer(PatrolTimer, this, &AEnemy::PatrolTimerFinished, WaitTime);
+		}
 	}
 }
 
 void AEnemy::StartPatrol()
 {
 	ClearAttackTimer();
+	StopFlowChase();
 	CombatTarget = nullptr;
 	SetHealthBarVisibility(false);
 	EnemyState = EEnemyState::EES_Patrolling;
-	GetCharacterMovement()->MaxWalkSpeed = PatrolSpeed;
+	GetCharacterMovement()->MaxWalkSpeed = GetArchetype().GetPatrolSpeed();
 	RemainingPatrolTargets = PatrolTargets;
 	MoveToTarget(PatrolTarget);
 }
@@ -323,8 +644,8 @@ void AEnemy::PatrolTimerFinished()
 void AEnemy::BeginPlay()
 {
 	Super::BeginPlay();
+	ApplyArchetype();
 	SetHealthBarVisibility(false);
-	GetCharacterMovement()->MaxWalkSpeed = PatrolSpeed;
 
 	EnemyController = Cast<AAIController>(GetController());
 	MoveToTarget(PatrolTarget);
@@ -332,22 +653,133 @@ void AEnemy::BeginPlay()
 	PatrolTarget = ChoosePatrolTarget();
 	SpawnDefaultWeapon();
 
-	if (PawnSensing)
+	Tags.Add(FName("Enemy"));
+
+	RegisterWithAIManager();
+	RegisterWithPerception();
+	RegisterWithSignificance();
+	MYPROJECT_INC_GAUGE(LiveEnemies);
+}
+
+void AEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromAIManager();
+	UnregisterFromPerception();
+	UnregisterFromSignificance();
+	StopFlowChase();
+	//Destroyed outside the pool, e.g. by a full pool, the world tears its weapons down itself otherwise
+	if (EndPlayReason == EEndPlayReason::Destroyed)
 	{
-		PawnSensing->OnSeePawn.AddDynamic(this, &AEnemy::PawnSeen);
+		ReleaseWeapons();
 	}
+	if (!bInPool)
+	{
+		MYPROJECT_DEC_GAUGE(LiveEnemies);
+	}
+	Super::EndPlay(EndPlayReason);
+}
 
-	Tags.Add(FName("Enemy"));
+void AEnemy::RegisterWithSignificance()
+{
+	if (UEnemySignificanceSubsystem* SignificanceSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UEnemySignificanceSubsystem>() : nullptr)
+	{
+		SignificanceSubsystem->RegisterEnemy(this);
+	}
+}
+
+void AEnemy::UnregisterFromSignificance()
+{
+	if (UEnemySignificanceSubsystem* SignificanceSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UEnemySignificanceSubsystem>() : nullptr)
+	{
+		SignificanceSubsystem->UnregisterEnemy(this);
+	}
+}
+
+void AEnemy::RegisterWithPerception()
+{
+	UWorld* World = GetWorld();
+	UEnemyPerceptionSubsystem* Perception = World ? World->GetSubsystem<UEnemyPerceptionSubsystem>() : nullptr;
+	if (Perception == nullptr) return;
+
+	Perception->RegisterObserver(this, GetArchetype().GetSightRadius(), GetArchetype().GetPeripheralVisionAngle());
+
+	//Observers register sensing, significance only reapplies its bucket when the bucket changes
+	const FEnemySignificanceSettings* Settings = GetSignificanceSettings();
+	if (Settings && !Settings->bSense)
+		Perception->SetObserverSensing(this, false);
+}
+
+void AEnemy::UnregisterFromPerception()
+{
+	if (UEnemyPerceptionSubsystem* Perception = GetWorld() ? GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>() : nullptr)
+	{
+		Perception->UnregisterObserver(this);
+	}
+}
+
+void AEnemy::RegisterWithAIManager()
+{
+	if (!bUseAIManager) return;
+
+	UEnemyAISubsystem* AIManager = GetWorld() ? GetWorld()->GetSubsystem<UEnemyAISubsystem>() : nullptr;
+	if (AIManager)
+	{
+		AIManager->RegisterEnemy(this);
+		if (const FEnemySignificanceSettings* Settings = GetSignificanceSettings())
+			AIManager->SetDecisionInterval(this, Settings->DecisionInterval);
+		SetActorTickEnabled(false);
+	}
+}
+
+void AEnemy::UnregisterFromAIManager()
+{
+	if (AISlot == INDEX_NONE) return;
+
+	if (UEnemyAISubsystem* AIManager = GetWorld() ? GetWorld()->GetSubsystem<UEnemyAISubsystem>() : nullptr)
+	{
+		AIManager->UnregisterEnemy(this);
+	}
 }
 
 void AEnemy::Tick(float DeltaTime)
 {
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_EnemyTick);
+
 	Super::Tick(DeltaTime);
 
+	if (AISlot == INDEX_NONE)
+		UpdateAI(ClassifyTarget(GetAITarget()));
+}
+
+void AEnemy::UpdateAI(EEnemyRangeBand TargetBand)
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_EnemyUpdateAI);
+
 	if (IsDead()) return;
 
 	if (EnemyState > EEnemyState::EES_Patrolling)
-		CheckCombatTarget();
+		CheckCombatTarget(TargetBand);
 	else
-		CheckPatrolTarget();
+		CheckPatrolTarget(TargetBand);
+}
+
+bool AEnemy::StartFlowChase()
+{
+	if (!bUseChaseFlowField) return false;
+
+	if (UChaseFlowFieldSubsystem* ChaseFlow = GetWorld() ? GetWorld()->GetSubsystem<UChaseFlowFieldSubsystem>() : nullptr)
+	{
+		return ChaseFlow->StartChase(this, CombatTarget);
+	}
+	return false;
+}
+
+void AEnemy::StopFlowChase()
+{
+	if (ChaseSlot == INDEX_NONE) return;
+
+	if (UChaseFlowFieldSubsystem* ChaseFlow = GetWorld() ? GetWorld()->GetSubsystem<UChaseFlowFieldSubsystem>() : nullptr)
+	{
+		ChaseFlow->StopChase(this);
+	}
 }
@@ -0,0 +1,14 @@
+#include "Enemy/EnemyAnimInstance.h"
+#include "MyProject/MyProject.h"
+
+void UEnemyAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaTime)
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_EnemyAnimUpdate);
+
+	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
+
+	GroundSpeed = Proxy.Velocity.Size2D();
+	IsFalling = Proxy.bIsFalling;
+	EnemyState = Proxy.EnemyState;
+	DeathPose = Proxy.DeathPose;
+}
@@ -0,0 +1,61 @@
+#include "Enemy/EnemyArchetype.h"
+#include "Enemy/Enemy.h"
+#include "UObject/UObjectIterator.h"
+#include "Misc/DataValidation.h"
+
+#define LOCTEXT_NAMESPACE "EnemyArchetype"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEnemyArchetype, Log, All);
+
+void UEnemyArchetype::PostInitProperties()
+{
+	Super::PostInitProperties();
+	RebuildCache();
+}
+
+void UEnemyArchetype::PostLoad()
+{
+	Super::PostLoad();
+	RebuildCache();
+}
+
+#if WITH_EDITOR
+void UEnemyArchetype::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	RebuildCache();
+
+	//Bands assume nested radii, the values are left as the designer set them
+	if (!HasNestedRanges())
+	{
+		UE_LOG(LogEnemyArchetype, Warning, TEXT("%s: ranges should be nested (Attack %.0f <= Combat %.0f <= Patrol %.0f)"),
+			*GetName(), AttackRadius, CombatRadius, PatrolRadius);
+	}
+
+	//Speeds, health and sight are copied out when applied, push them to enemies already in play
+	for (TObjectIterator<AEnemy> It; It; ++It)
+	{
+		UWorld* World = It->GetWorld();
+		if (World && World->IsGameWorld() && &It->GetArchetype() == this)
+			It->SetArchetype(this);
+	}
+}
+
+EDataValidationResult UEnemyArchetype::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+	if (!HasNestedRanges())
+	{
+		Context.AddWarning(FText::Format(LOCTEXT("RangesNotNested", "Ranges should be nested: Attack ({0}) <= Combat ({1}) <= Patrol ({2}), range bands will not match separate range checks"),
+			AttackRadius, CombatRadius, PatrolRadius));
+	}
+	return Result;
+}
+#endif
+
+void UEnemyArchetype::RebuildCache()
+{
+	RangeRadii = FEnemyRangeRadii(AttackRadius, CombatRadius, PatrolRadius);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,14 +1,66 @@
 #include "HUD/HealthBarComponent.h"
+#include "MyProject/MyProject.h"
 #include "HUD/HealthBar.h"
+#include "HUD/HealthBarSubsystem.h"
 #include "Components/ProgressBar.h"
 
+void UHealthBarComponent::BeginPlay()
+{
+	//No widget and no render target when the HUD draws the bar
+	if (bDrawWithHUD)
+	{
+		WidgetClass = nullptr;
+		SetComponentTickEnabled(false);
+	}
+
+	Super::BeginPlay();
+	UpdateHUDBar();
+}
+
+void UHealthBarComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UHealthBarSubsystem* HealthBars = GetWorld() ? GetWorld()->GetSubsystem<UHealthBarSubsystem>() : nullptr)
+	{
+		HealthBars->RemoveBar(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void UHealthBarComponent::InitWidget()
+{
+	Super::InitWidget();
+	HealthBarWidget = Cast<UHealthBar>(GetUserWidgetObject());
+}
+
+void UHealthBarComponent::OnVisibilityChanged()
+{
+	Super::OnVisibilityChanged();
+	UpdateHUDBar();
+}
+
+void UHealthBarComponent::UpdateHUDBar()
+{
+	if (!bDrawWithHUD || !HasBegunPlay()) return;
+
+	UHealthBarSubsystem* HealthBars = GetWorld() ? GetWorld()->GetSubsystem<UHealthBarSubsystem>() : nullptr;
+	if (HealthBars == nullptr) return;
+
+	if (IsVisible())
+		HealthBars->AddBar(this);
+	else
+		HealthBars->RemoveBar(this);
+}
+
 void UHealthBarComponent::SetHealthPercent(float Percent)
 {
-	if (HealthBarWidget == nullptr)
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_HUDUpdate);
+
+	HealthPercent = Percent;
+	if (BarSlot != INDEX_NONE)
 	{
-		HealthBarWidget = Cast<UHealthBar>(GetUserWidgetObject());
+		GetWorld()->GetSubsystem<UHealthBarSubsystem>()->SetPercent(this, Percent);
 	}
-	if (HealthBarWidget && HealthBarWidget->HealthBar)
+	else if (HealthBarWidget && HealthBarWidget->HealthBar)
 	{
 		HealthBarWidget->HealthBar->SetPercent(Percent);
 	}
@@ -0,0 +1,37 @@
+#include "HUD/HealthBarSubsystem.h"
+#include "HUD/HealthBarComponent.h"
+
+void UHealthBarSubsystem::Deinitialize()
+{
+	Bars.Empty();
+	Percents.Empty();
+	Super::Deinitialize();
+}
+
+void UHealthBarSubsystem::AddBar(UHealthBarComponent* Bar)
+{
+	if (Bar == nullptr || Bar->BarSlot != INDEX_NONE) return;
+
+	Bar->BarSlot = Bars.Add(Bar);
+	Percents.Add(Bar->GetHealthPercent());
+}
+
+void UHealthBarSubsystem::RemoveBar(UHealthBarComponent* Bar)
+{
+	if (Bar == nullptr || !Bars.IsValidIndex(Bar->BarSlot)) return;
+
+	const int32 Slot = Bar->BarSlot;
+	Bars.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Percents.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	if (Bars.IsValidIndex(Slot))
+	{
+		Bars[Slot]->BarSlot = Slot;
+	}
+	Bar->BarSlot = INDEX_NONE;
+}
+
+void UHealthBarSubsystem::SetPercent(const UHealthBarComponent* Bar, float Percent)
+{
+	if (Bar && Percents.IsValidIndex(Bar->BarSlot))
+		Percents[Bar->BarSlot] = Percent;
+}
@@ -3,6 +3,11 @@
 
 #include "HUD/PlayerHUD.h"
 #include "HUD/PlayerOverlay.h"
+#include "HUD/HealthBarComponent.h"
+#include "HUD/HealthBarSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Engine/Canvas.h"
+#include "Camera/PlayerCameraManager.h"
 
 void APlayerHUD::BeginPlay()
 {
@@ -24,3 +29,49 @@ void APlayerHUD::PreInitializeComponents()
 		}
 	}
 }
+
+void APlayerHUD::DrawHUD()
+{
+	Super::DrawHUD();
+	DrawEnemyHealthBars();
+}
+
+void APlayerHUD::DrawEnemyHealthBars()
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_HUDUpdate);
+
+	const UHealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UHealthBarSubsystem>();
+	if (HealthBars == nullptr || HealthBars->GetNumBars() == 0 || PlayerOwner == nullptr || PlayerOwner->PlayerCameraManager == nullptr) return;
+
+	const FVector ViewLocation = PlayerOwner->PlayerCameraManager->GetCameraLocation();
+	const FVector ViewForward = PlayerOwner->PlayerCameraManager->GetCameraRotation().Vector();
+	const double MaxDistanceSquared = FMath::Square(MaxHealthBarDistance);
+
+	VisibleHealthBars.Reset();
+	for (int32 i = 0; i < HealthBars->GetNumBars(); i++)
+	{
+		const FVector Location = HealthBars->GetBar(i)->GetComponentLocation() + FVector(0.f, 0.f, HealthBarHeight);
+		const FVector ToBar = Location - ViewLocation;
+		const double DistanceSquared = ToBar.SizeSquared();
+		if (DistanceSquared > MaxDistanceSquared || FVector::DotProduct(ToBar, ViewForward) <= 0.0) continue;
+
+		const FVector ScreenLocation = Project(Location);
+		if (ScreenLocation.X < 0.0 || ScreenLocation.X > Canvas->SizeX || ScreenLocation.Y < 0.0 || ScreenLocation.Y > Canvas->SizeY) continue;
+
+		VisibleHealthBars.Add({ FVector2D(ScreenLocation), DistanceSquared, HealthBars->GetPercent(i) });
+	}
+
+	if (VisibleHealthBars.Num() > MaxHealthBars)
+	{
+		VisibleHealthBars.Sort([](const FVisibleHealthBar& A, const FVisibleHealthBar& B) { return A.DistanceSquared < B.DistanceSquared; });
+		VisibleHealthBars.SetNum(MaxHealthBars, EAllowShrinking::No);
+	}
+
+	//Untextured tiles share one batched element, so all bars go out in one draw
+	for (const FVisibleHealthBar& Bar : VisibleHealthBars)
+	{
+		const float Left = Bar.ScreenLocation.X - HealthBarSize.X * 0.5f;
+		DrawRect(HealthBarBackgroundColor, Left, Bar.ScreenLocation.Y, HealthBarSize.X, HealthBarSize.Y);
+		DrawRect(HealthBarColor, Left, Bar.ScreenLocation.Y, HealthBarSize.X * FMath::Clamp(Bar.Percent, 0.f, 1.f), HealthBarSize.Y);
+	}
+}
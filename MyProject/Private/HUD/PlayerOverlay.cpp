@@ -2,35 +2,100 @@
 
 
 #include "HUD/PlayerOverlay.h"
+#include "MyProject/MyProject.h"
 #include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
+#include "Components/AttributeComponent.h"
+
+bool FNumberTextCache::Update(int32 Value, FText& OutText)
+{
+	if (bHasDisplayed && DisplayedValue == Value) return false;
+	DisplayedValue = Value;
+	bHasDisplayed = true;
+
+	for (int32 i = 0; i < NumEntries; i++)
+	{
+		if (Values[i] == Value)
+		{
+			OutText = Texts[i];
+			return true;
+		}
+	}
+
+	OutText = FText::AsNumber(Value, &FNumberFormattingOptions::DefaultNoGrouping());
+	Values[NextSlot] = Value;
+	Texts[NextSlot] = OutText;
+	NextSlot = (NextSlot + 1) % Capacity;
+	NumEntries = FMath::Min(NumEntries + 1, Capacity);
+	return true;
+}
+
+void UPlayerOverlay::BindToAttributes(UAttributeComponent* Attributes)
+{
+	if (Attributes == nullptr) return;
+	BoundAttributes = Attributes;
+
+	Attributes->OnHealthChanged.AddUniqueDynamic(this, &UPlayerOverlay::SetHealthBarPercent);
+	Attributes->OnStaminaChanged.AddUniqueDynamic(this, &UPlayerOverlay::SetStaminaBarPercent);
+	Attributes->OnGoldChanged.AddUniqueDynamic(this, &UPlayerOverlay::SetGold);
+	Attributes->OnSoulsChanged.AddUniqueDynamic(this, &UPlayerOverlay::SetSouls);
+
+	SetHealthBarPercent(Attributes->GetHealthPercent());
+	SetStaminaBarPercent(Attributes->GetStaminaPercent());
+	SetGold(Attributes->GetGold());
+	SetSouls(Attributes->GetSouls());
+}
+
+void UPlayerOverlay::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (DisplayedStaminaPercent < 1.f && BoundAttributes.IsValid())
+	{
+		SetStaminaBarPercent(BoundAttributes->GetStaminaPercent());
+	}
+}
 
 void UPlayerOverlay::SetHealthBarPercent(float Percent)
 {
-	if (HealthProgressBar)
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_HUDUpdate);
+
+	if (HealthProgressBar && Percent != DisplayedHealthPercent)
+	{
+		DisplayedHealthPercent = Percent;
 		HealthProgressBar->SetPercent(Percent);
+	}
 }
 
 void UPlayerOverlay::SetStaminaBarPercent(float Percent)
 {
-	if (StaminaProgressBar)
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_HUDUpdate);
+
+	if (StaminaProgressBar && Percent != DisplayedStaminaPercent)
+	{
+		DisplayedStaminaPercent = Percent;
 		StaminaProgressBar->SetPercent(Percent);
+	}
 }
 
 void UPlayerOverlay::SetGold(int32 Gold)
 {
-	if (GoldText)
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_HUDUpdate);
+
+	FText Text;
+	if (GoldText && GoldTextCache.Update(Gold, Text))
 	{
-		FText Text = FText::FromString(FString::Printf(TEXT("%d"), Gold));
 		GoldText->SetText(Text);
 	}
 }
 
 void UPlayerOverlay::SetSouls(int32 Souls)
 {
-	if (SoulText)
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_HUDUpdate);
+
+	FText Text;
+	if (SoulText && SoulTextCache.Update(Souls, Text))
 	{
-		FText Text = FText::FromString(FString::Printf(TEXT("%d"), Souls));
 		SoulText->SetText(Text);
 	}
 }
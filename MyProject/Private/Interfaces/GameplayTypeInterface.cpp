@@ -0,0 +1,17 @@
+#include "Interfaces/GameplayTypeInterface.h"
+
+EGameplayTypeFlags IGameplayTypeInterface::GetTypeFlags() const
+{
+	return EGameplayTypeFlags::EGTF_None;
+}
+
+EGameplayTypeFlags IGameplayTypeInterface::GetActorTypeFlags(const AActor* Actor)
+{
+	const IGameplayTypeInterface* TypeInterface = Cast<const IGameplayTypeInterface>(Actor);
+	return TypeInterface ? TypeInterface->GetTypeFlags() : EGameplayTypeFlags::EGTF_None;
+}
+
+bool IGameplayTypeInterface::ActorHasAnyTypeFlags(const AActor* Actor, EGameplayTypeFlags Flags)
+{
+	return EnumHasAnyFlags(GetActorTypeFlags(Actor), Flags);
+}
@@ -2,5 +2,44 @@
 
 
 #include "Interfaces/HitInterface.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/DamageType.h"
 
 // Add default functionality here for any IHitInterface functions that are not pure virtual.
+
+void IHitInterface::ApplyResolvedDamage(float Damage, AController* EventInstigator, AActor* DamageCauser)
+{
+	if (AActor* Target = Cast<AActor>(_getUObject()))
+		UGameplayStatics::ApplyDamage(Target, Damage, EventInstigator, DamageCauser, UDamageType::StaticClass());
+}
+
+void IHitInterface::ReceiveResolvedHit(const FVector& ImpactPoint, AActor* Hitter, AController* EventInstigator)
+{
+	Execute_GetHit(_getUObject(), ImpactPoint, Hitter);
+}
+
+void IHitInterface::DispatchDamage(AActor* Target, float Damage, AController* EventInstigator, AActor* DamageCauser)
+{
+	if (Target == nullptr) return;
+
+	if (IHitInterface* HitInterface = Cast<IHitInterface>(Target))
+		HitInterface->ApplyResolvedDamage(Damage, EventInstigator, DamageCauser);
+	else
+		UGameplayStatics::ApplyDamage(Target, Damage, EventInstigator, DamageCauser, UDamageType::StaticClass());
+}
+
+void IHitInterface::DispatchReaction(AActor* Target, const FVector& ImpactPoint, AActor* Hitter, AController* EventInstigator)
+{
+	if (Target == nullptr) return;
+
+	if (IHitInterface* HitInterface = Cast<IHitInterface>(Target))
+		HitInterface->ReceiveResolvedHit(ImpactPoint, Hitter, EventInstigator);
+	else if (Target->Implements<UHitInterface>())
+		Execute_GetHit(Target, ImpactPoint, Hitter);
+}
+
+void IHitInterface::DispatchHit(AActor* Target, const FVector& ImpactPoint, AActor* Hitter, float Damage, AController* EventInstigator, AActor* DamageCauser)
+{
+	DispatchDamage(Target, Damage, EventInstigator, DamageCauser);
+	DispatchReaction(Target, ImpactPoint, Hitter, EventInstigator);
+}
@@ -0,0 +1,11 @@
+#include "Interfaces/PoolableInterface.h"
+
+// Add default functionality here for any IPoolableInterface functions that are not pure virtual.
+
+void IPoolableInterface::OnAcquiredFromPool()
+{
+}
+
+void IPoolableInterface::OnReleasedToPool()
+{
+}
@@ -2,13 +2,15 @@
 
 
 #include "Items/Item.h"
+#include "MyProject/MyProject.h"
 #include "MyProject/DebugMacros.h"
 #include "Components/SphereComponent.h"
 #include "Characters/SlashCharacter.h"
 #include "Interfaces/PickupInterface.h"
 #include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
-#include "Kismet/GameplayStatics.h"
+#include "Effects/EffectsBudgetSubsystem.h"
+#include "Pooling/ActorPoolSubsystem.h"
+#include "Items/ItemHoverSubsystem.h"
 
 // Sets default values
 AItem::AItem() 
@@ -16,8 +18,8 @@ AItem::AItem()
 	Amplitude(0.25f),
 	TimeConstant(5.f)
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+ 	//Hovering is driven by UItemHoverSubsystem
+	PrimaryActorTick.bCanEverTick = false;
 
 	ItemMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("ItemMeshComponent"));
 	ItemMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
@@ -40,6 +42,89 @@ void AItem::BeginPlay()
 
 	Sphere->OnComponentEndOverlap.AddDynamic(this, &AItem::OnSphereEndOverlap);
 
+	if (ItemState == EItemState::EIS_Hovering)
+		StartHovering();
+
+	MYPROJECT_INC_GAUGE(LiveItems);
+}
+
+void AItem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopHovering();
+	MYPROJECT_DEC_GAUGE(LiveItems);
+	Super::EndPlay(EndPlayReason);
+}
+
+void AItem::StartHovering()
+{
+	if (HoverSlot != INDEX_NONE) return;
+
+	UItemHoverSubsystem* HoverSubsystem = GetWorld()->GetSubsystem<UItemHoverSubsystem>();
+	if (HoverSubsystem == nullptr) return;
+
+	if (Sphere)
+	{
+		SphereRelativeLocation = Sphere->GetRelativeLocation();
+		const FVector SphereLocation = Sphere->GetComponentLocation();
+		Sphere->SetUsingAbsoluteLocation(true);
+		Sphere->SetWorldLocation(SphereLocation);
+	}
+	RunningTime = 0.f;
+	HoverSubsystem->RegisterItem(this, Amplitude, TimeConstant);
+}
+
+void AItem::StopHovering()
+{
+	if (HoverSlot == INDEX_NONE) return;
+
+	if (UItemHoverSubsystem* HoverSubsystem = GetWorld()->GetSubsystem<UItemHoverSubsystem>())
+	{
+		RunningTime = HoverSubsystem->UnregisterItem(this);
+	}
+	if (Sphere)
+	{
+		Sphere->SetUsingAbsoluteLocation(false);
+		Sphere->SetRelativeLocation(SphereRelativeLocation);
+	}
+}
+
+void AItem::OnAcquiredFromPool()
+{
+	ItemState = EItemState::EIS_Hovering;
+	GetWorldTimerManager().ClearTimer(DespawnTimer);
+	StartHovering();
+
+	if (Sphere)
+	{
+		Sphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	}
+	if (SparkleEffect)
+	{
+		SparkleEffect->Activate(true);
+	}
+}
+
+void AItem::OnReleasedToPool()
+{
+	StopHovering();
+	GetWorldTimerManager().ClearTimer(DespawnTimer);
+	SetOwner(nullptr);
+	SetInstigator(nullptr);
+
+	if (SparkleEffect)
+	{
+		SparkleEffect->Deactivate();
+	}
+}
+
+void AItem::Despawn()
+{
+	UActorPoolSubsystem::ReleaseOrDestroy(this);
+}
+
+void AItem::DespawnAfter(float Delay)
+{
+	GetWorldTimerManager().SetTimer(DespawnTimer, this, &AItem::Despawn, Delay);
 }
 
 float AItem::TransformedSin()
@@ -77,7 +162,7 @@ void AItem::SpawnPickupSystem()
 {
 	if (PickupEffect)
 	{
-		UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, PickupEffect, GetActorLocation());
+		UEffectsBudgetSubsystem::SpawnNiagara(this, PickupEffect, GetActorLocation());
 	}
 }
 
@@ -85,19 +170,6 @@ void AItem::PlayPickupSound()
 {
 	if (PickupSound )
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, PickupSound, GetActorLocation());
+		UEffectsBudgetSubsystem::PlaySound(this, PickupSound, GetActorLocation());
 	}
 }
-
-// Called every frame
-void AItem::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	RunningTime += DeltaTime;
-
-	if(ItemState == EItemState::EIS_Hovering)
-		AddActorWorldOffset(FVector(0.f, 0.f, TransformedSin()));
-
-}
-
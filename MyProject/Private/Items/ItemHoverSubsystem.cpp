@@ -0,0 +1,96 @@
+#include "Items/ItemHoverSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Items/Item.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+namespace
+{
+	//Items used to add Amplitude * sin(t * TimeConstant) every frame, which summed at 60 fps
+	//to Amplitude / (TimeConstant * ReferenceDelta) * (1 - cos(t * TimeConstant))
+	constexpr float ReferenceDelta = 1.f / 60.f;
+}
+
+void UItemHoverSubsystem::Deinitialize()
+{
+	Items.Empty();
+	BaseLocations.Empty();
+	RunningTimes.Empty();
+	HoverHeights.Empty();
+	TimeConstants.Empty();
+	PendingRemovals = 0;
+	Super::Deinitialize();
+}
+
+TStatId UItemHoverSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemHoverSubsystem, STATGROUP_MyProject);
+}
+
+void UItemHoverSubsystem::RegisterItem(AItem* Item, float Amplitude, float TimeConstant)
+{
+	if (Item == nullptr || Item->HoverSlot != INDEX_NONE) return;
+
+	Item->HoverSlot = Items.Add(Item);
+	BaseLocations.Add(Item->GetActorLocation());
+	RunningTimes.Add(0.f);
+	HoverHeights.Add(TimeConstant != 0.f ? Amplitude / (TimeConstant * ReferenceDelta) : 0.f);
+	TimeConstants.Add(TimeConstant);
+}
+
+float UItemHoverSubsystem::UnregisterItem(AItem* Item)
+{
+	if (Item == nullptr || !Items.IsValidIndex(Item->HoverSlot)) return 0.f;
+
+	//Slots are compacted at the start of the next tick, moving an item can end up releasing another one
+	const float RunningTime = RunningTimes[Item->HoverSlot];
+	Items[Item->HoverSlot] = nullptr;
+	Item->HoverSlot = INDEX_NONE;
+	PendingRemovals++;
+	return RunningTime;
+}
+
+void UItemHoverSubsystem::CompactSlots()
+{
+	for (int32 i = Items.Num() - 1; i >= 0; i--)
+	{
+		if (Items[i]) continue;
+
+		Items.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		BaseLocations.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		RunningTimes.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		HoverHeights.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		TimeConstants.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		if (Items.IsValidIndex(i))
+		{
+			Items[i]->HoverSlot = i;
+		}
+	}
+	PendingRemovals = 0;
+}
+
+void UItemHoverSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	if (PendingRemovals > 0) CompactSlots();
+
+	const int32 NumItems = Items.Num();
+	for (int32 i = 0; i < NumItems; i++)
+	{
+		RunningTimes[i] += DeltaTime;
+	}
+
+	for (int32 i = 0; i < NumItems; i++)
+	{
+		AItem* Item = Items[i];
+		if (Item == nullptr) continue;
+
+		//Blueprints read RunningTime through TransformedSin and TransformedCosin
+		Item->RunningTime = RunningTimes[i];
+		const float Offset = HoverHeights[i] * (1.f - FMath::Cos(RunningTimes[i] * TimeConstants[i]));
+		Item->SetActorLocation(BaseLocations[i] + FVector(0.f, 0.f, Offset), false, nullptr, ETeleportType::TeleportPhysics);
+	}
+}
@@ -0,0 +1,115 @@
+#include "Items/LootSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Items/LootTable.h"
+#include "Items/Treasure.h"
+#include "Pooling/ActorPoolSubsystem.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+void ULootSubsystem::Deinitialize()
+{
+	PendingLoot.Empty();
+	RollingLoot.Empty();
+	Streams.Empty();
+	Drops.Empty();
+	DropCounts.Empty();
+	FallbackTables.Empty();
+	Super::Deinitialize();
+}
+
+TStatId ULootSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULootSubsystem, STATGROUP_MyProject);
+}
+
+void ULootSubsystem::QueueLoot(ULootTable* Table, const FRandomStream& Stream, const FTransform& DropTransform)
+{
+	if (Table == nullptr) return;
+	PendingLoot.Add({ Table, Stream, DropTransform });
+}
+
+ULootTable* ULootSubsystem::GetFallbackTable(const TArray<TSubclassOf<ATreasure>>& TreasureClasses)
+{
+	if (TreasureClasses.IsEmpty()) return nullptr;
+
+	for (ULootTable* Table : FallbackTables)
+	{
+		if (Table->GetTreasureClasses() == TreasureClasses)
+			return Table;
+	}
+
+	ULootTable* Table = NewObject<ULootTable>(this);
+	Table->SetTreasureClasses(TreasureClasses);
+	FallbackTables.Add(Table);
+	return Table;
+}
+
+void ULootSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+
+	if (PendingLoot.Num() > 0)
+		RollPendingLoot();
+}
+
+void ULootSubsystem::RollPendingLoot()
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_LootRoll);
+
+	Swap(PendingLoot, RollingLoot);
+	PendingLoot.Reset();
+
+	//Group by table, keeping break order inside each group
+	RollingLoot.StableSort([](const FPendingLoot& A, const FPendingLoot& B)
+	{
+		return reinterpret_cast<UPTRINT>(A.Table.Get()) < reinterpret_cast<UPTRINT>(B.Table.Get());
+	});
+
+	int32 First = 0;
+	while (First < RollingLoot.Num())
+	{
+		ULootTable* Table = RollingLoot[First].Table.Get();
+		int32 Last = First;
+		Streams.Reset();
+		while (Last < RollingLoot.Num() && RollingLoot[Last].Table.Get() == Table)
+		{
+			Streams.Add(RollingLoot[Last].Stream);
+			Last++;
+		}
+
+		if (Table)
+		{
+			Drops.Reset();
+			Table->RollDropsBulk(Streams, Drops, DropCounts);
+
+			int32 DropIndex = 0;
+			for (int32 i = 0; i < DropCounts.Num(); i++)
+			{
+				SpawnDrops(TConstArrayView<TSubclassOf<ATreasure>>(Drops.GetData() + DropIndex, DropCounts[i]), RollingLoot[First + i].DropTransform);
+				DropIndex += DropCounts[i];
+			}
+		}
+		First = Last;
+	}
+	RollingLoot.Reset();
+}
+
+void ULootSubsystem::SpawnDrops(TConstArrayView<TSubclassOf<ATreasure>> BreakDrops, const FTransform& DropTransform)
+{
+	UWorld* World = GetWorld();
+	UActorPoolSubsystem* ActorPool = World->GetSubsystem<UActorPoolSubsystem>();
+
+	//Extra drops are spread around the first so their pickup spheres don't stack
+	for (int32 i = 0; i < BreakDrops.Num(); i++)
+	{
+		const FVector Offset = i > 0 ? FRotator(0.f, 360.f * i / BreakDrops.Num(), 0.f).Vector() * 50.f : FVector::ZeroVector;
+		const FTransform SpawnTransform(DropTransform.GetRotation(), DropTransform.GetLocation() + Offset);
+		if (ActorPool)
+			ActorPool->Acquire<ATreasure>(BreakDrops[i], SpawnTransform);
+		else
+			World->SpawnActor<ATreasure>(BreakDrops[i], SpawnTransform);
+	}
+	INC_DWORD_STAT_BY(STAT_LootSpawned, BreakDrops.Num());
+}
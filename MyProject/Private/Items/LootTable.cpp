@@ -0,0 +1,161 @@
+#include "Items/LootTable.h"
+#include "Items/Treasure.h"
+#include "UObject/UObjectIterator.h"
+
+void FAliasSampler::Reset()
+{
+	Probabilities.Reset();
+	Aliases.Reset();
+	Outcomes.Reset();
+}
+
+void FAliasSampler::Build(TConstArrayView<float> Weights)
+{
+	Reset();
+
+	double TotalWeight = 0.0;
+	for (int32 i = 0; i < Weights.Num(); i++)
+	{
+		if (Weights[i] <= 0.f) continue;
+		Outcomes.Add(i);
+		TotalWeight += Weights[i];
+	}
+
+	const int32 NumOutcomes = Outcomes.Num();
+	if (NumOutcomes == 0) return;
+
+	//Scale so the average weight is 1, then pair each under-full slot with an over-full one
+	TArray<double, TInlineAllocator<16>> Scaled;
+	Scaled.SetNumUninitialized(NumOutcomes);
+	TArray<int32, TInlineAllocator<16>> Small;
+	TArray<int32, TInlineAllocator<16>> Large;
+	for (int32 i = 0; i < NumOutcomes; i++)
+	{
+		Scaled[i] = Weights[Outcomes[i]] * NumOutcomes / TotalWeight;
+		if (Scaled[i] < 1.0)
+			Small.Add(i);
+		else
+			Large.Add(i);
+	}
+
+	Probabilities.SetNumUninitialized(NumOutcomes);
+	Aliases.SetNumUninitialized(NumOutcomes);
+	while (Small.Num() > 0 && Large.Num() > 0)
+	{
+		const int32 Less = Small.Pop(EAllowShrinking::No);
+		const int32 More = Large.Pop(EAllowShrinking::No);
+
+		Probabilities[Less] = static_cast<float>(Scaled[Less]);
+		Aliases[Less] = More;
+
+		Scaled[More] = (Scaled[More] + Scaled[Less]) - 1.0;
+		if (Scaled[More] < 1.0)
+			Small.Add(More);
+		else
+			Large.Add(More);
+	}
+
+	//Whatever is left is 1 up to rounding error
+	for (int32 i : Large)
+	{
+		Probabilities[i] = 1.f;
+		Aliases[i] = i;
+	}
+	for (int32 i : Small)
+	{
+		Probabilities[i] = 1.f;
+		Aliases[i] = i;
+	}
+}
+
+int32 FAliasSampler::Sample(const FRandomStream& Stream) const
+{
+	if (IsEmpty()) return INDEX_NONE;
+
+	const int32 Slot = Stream.RandHelper(Probabilities.Num());
+	return Outcomes[Stream.GetFraction() < Probabilities[Slot] ? Slot : Aliases[Slot]];
+}
+
+void ULootTable::BuildSampler(TConstArrayView<TSubclassOf<ATreasure>> Classes, FAliasSampler& OutSampler)
+{
+	TArray<float, TInlineAllocator<16>> Weights;
+	Weights.Reserve(Classes.Num());
+	for (const TSubclassOf<ATreasure>& TreasureClass : Classes)
+	{
+		const ATreasure* Treasure = TreasureClass.GetDefaultObject();
+		Weights.Add(Treasure ? Treasure->GetDropRate() : 0.f);
+	}
+	OutSampler.Build(Weights);
+}
+
+void ULootTable::Compile()
+{
+	BuildSampler(TreasureClasses, Sampler);
+	bCompiled = true;
+}
+
+void ULootTable::SetTreasureClasses(const TArray<TSubclassOf<ATreasure>>& Classes)
+{
+	TreasureClasses = Classes;
+	bCompiled = false;
+}
+
+#if WITH_EDITOR
+void ULootTable::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	bCompiled = false;
+}
+
+void ULootTable::MarkAllDirty()
+{
+	for (TObjectIterator<ULootTable> It; It; ++It)
+	{
+		It->bCompiled = false;
+	}
+}
+#endif
+
+TSubclassOf<ATreasure> ULootTable::RollDrop(const FRandomStream& Stream)
+{
+	if (!bCompiled) Compile();
+
+	const int32 Selection = Sampler.Sample(Stream);
+	return Selection != INDEX_NONE ? TreasureClasses[Selection] : nullptr;
+}
+
+int32 ULootTable::RollDrops(const FRandomStream& Stream, TArray<TSubclassOf<ATreasure>>& OutDrops)
+{
+	if (!bCompiled) Compile();
+	if (Sampler.IsEmpty()) return 0;
+
+	const int32 NumDrops = RollDropCount(Stream);
+	for (int32 i = 0; i < NumDrops; i++)
+	{
+		OutDrops.Add(TreasureClasses[Sampler.Sample(Stream)]);
+	}
+	return NumDrops;
+}
+
+void ULootTable::RollDropsBulk(TConstArrayView<FRandomStream> Streams, TArray<TSubclassOf<ATreasure>>& OutDrops, TArray<int32>& OutDropCounts)
+{
+	if (!bCompiled) Compile();
+
+	OutDropCounts.Reset(Streams.Num());
+	if (Sampler.IsEmpty())
+	{
+		OutDropCounts.AddZeroed(Streams.Num());
+		return;
+	}
+
+	OutDrops.Reserve(OutDrops.Num() + Streams.Num() * FMath::Max(MinDrops, MaxDrops));
+	for (const FRandomStream& Stream : Streams)
+	{
+		const int32 NumDrops = RollDropCount(Stream);
+		for (int32 i = 0; i < NumDrops; i++)
+		{
+			OutDrops.Add(TreasureClasses[Sampler.Sample(Stream)]);
+		}
+		OutDropCounts.Add(NumDrops);
+	}
+}
@@ -19,6 +19,6 @@ void ASoul::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* Ot
 		PickupInterface->AddSouls(this);
 		SpawnPickupSystem();
 		PlayPickupSound();
-		Destroy();
+		Despawn();
 	}
 }
@@ -3,6 +3,18 @@
 
 #include "Items/Treasure.h"
 #include "Interfaces/PickupInterface.h"
+#include "Items/LootTable.h"
+
+#if WITH_EDITOR
+void ATreasure::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	//Loot tables bake DropRate into their samplers
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(ATreasure, DropRate))
+		ULootTable::MarkAllDirty();
+}
+#endif
 
 void ATreasure::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
@@ -13,6 +25,6 @@ void ATreasure::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor
 		PickupInterface->AddGold(this);
 		SpawnPickupSystem();
 		PlayPickupSound();
-		Destroy();
+		Despawn();
 	}
 }
@@ -0,0 +1,53 @@
+#include "Items/Weapons/EnemyWeapon.h"
+#include "Items/Weapons/WeaponHitComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/BoxComponent.h"
+
+AEnemyWeapon::AEnemyWeapon()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	WeaponMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Weapon Mesh"));
+	WeaponMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	WeaponMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
+	WeaponMesh->SetGenerateOverlapEvents(false);
+	RootComponent = WeaponMesh;
+
+	WeaponBox = CreateDefaultSubobject<UBoxComponent>(TEXT("Weapon Box"));
+	WeaponBox->SetupAttachment(GetRootComponent());
+	WeaponBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	WeaponBox->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
+	WeaponBox->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECR_Ignore);
+
+	HitComponent = CreateDefaultSubobject<UWeaponHitComponent>(TEXT("Hit Detection"));
+}
+
+void AEnemyWeapon::BeginPlay()
+{
+	Super::BeginPlay();
+
+	HitComponent->SetHitVolume(WeaponBox);
+	HitComponent->OnWeaponHit.AddUObject(this, &AEnemyWeapon::OnWeaponHit);
+}
+
+void AEnemyWeapon::OnReleasedToPool()
+{
+	HitComponent->SetHitVolumeEnabled(ECollisionEnabled::NoCollision);
+	SetOwner(nullptr);
+	SetInstigator(nullptr);
+}
+
+void AEnemyWeapon::Equip(USceneComponent* InParent, FName InSocketName, AActor* NewOwner, APawn* NewInstigator)
+{
+	SetOwner(NewOwner);
+	SetInstigator(NewInstigator);
+	HitComponent->ResetSwingHits();
+
+	FAttachmentTransformRules TransformRules(EAttachmentRule::SnapToTarget, true);
+	WeaponMesh->AttachToComponent(InParent, TransformRules, InSocketName);
+}
+
+void AEnemyWeapon::OnWeaponHit(const FHitResult& Hit)
+{
+	CreateFields(Hit.ImpactPoint);
+}
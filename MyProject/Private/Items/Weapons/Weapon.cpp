@@ -1,10 +1,11 @@
 #include "Items/Weapons/Weapon.h"
+#include "MyProject/MyProject.h"
 #include "Components/SphereComponent.h"
 #include "Components/BoxComponent.h"
 #include <Characters/SlashCharacter.h>
 #include <Kismet/GameplayStatics.h>
-#include "Kismet/KismetSystemLibrary.h"
-#include "Interfaces/HitInterface.h"
+#include "Items/Weapons/WeaponHitComponent.h"
+#include "Interfaces/GameplayTypeInterface.h"
 #include "NiagaraComponent.h"
 
 
@@ -21,84 +22,62 @@ AWeapon::AWeapon()
 
 	BoxTraceEnd = CreateDefaultSubobject<USceneComponent>(TEXT("Box Trace End"));
 	BoxTraceEnd->SetupAttachment(GetRootComponent());
+
+	HitComponent = CreateDefaultSubobject<UWeaponHitComponent>(TEXT("Hit Detection"));
+	HitComponent->SetSettingsFromOwner();
+
+	SwingObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_WorldDynamic));
+	SwingObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_PhysicsBody));
+	SwingObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_Destructible));
 }
 
 void AWeapon::BeginPlay()
 {
 	Super::BeginPlay();
 
-	WeaponBox->OnComponentBeginOverlap.AddDynamic(this, &AWeapon::OnBoxOverlap);
+	HitComponent->SetHitVolume(WeaponBox, BoxTraceStart, BoxTraceEnd);
+	HitComponent->OnWeaponHit.AddUObject(this, &AWeapon::OnWeaponHit);
 }
 
-
-void AWeapon::BoxTrace(FHitResult& BoxHit)
+void AWeapon::PostInitializeComponents()
 {
-	const FVector Start = BoxTraceStart->GetComponentLocation();
-	const FVector End = BoxTraceEnd->GetComponentLocation();
+	Super::PostInitializeComponents();
 
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Add(this);
-	ActorsToIgnore.AddUnique(GetOwner());
-
-	for (AActor* Actor : IgnoreActors)
-	{
-		ActorsToIgnore.AddUnique(Actor);
-	}
-
-
-	UKismetSystemLibrary::BoxTraceSingle(this, Start, End, BoxTraceSize,
-		BoxTraceStart->GetComponentRotation(), ETraceTypeQuery::TraceTypeQuery1, 
-		false, ActorsToIgnore, 
-		bShowDebug ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None,
-		BoxHit, true);
-	IgnoreActors.AddUnique(BoxHit.GetActor());
+	HitComponent->SetTraceSettings(Damage, BoxTraceSize, bShowDebug);
+	HitComponent->SetSwingSettings(bUseSwingTrace, SwingSamples, SwingObjectTypes);
 }
 
-void AWeapon::ExecuteGetHit(FHitResult& BoxHit)
+void AWeapon::OnReleasedToPool()
 {
+	Super::OnReleasedToPool();
 
-	IHitInterface* HitInterface = Cast<IHitInterface>(BoxHit.GetActor());
-	if (HitInterface)
-	{
-		HitInterface->Execute_GetHit(BoxHit.GetActor(), BoxHit.ImpactPoint, GetOwner());
-	}
+	HitComponent->SetHitVolumeEnabled(ECollisionEnabled::NoCollision);
 }
 
-void AWeapon::OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void AWeapon::BeginSwing()
 {
-	FName Type = FName(TEXT("Enemy"));
-	if (ActorIsSameType(Type, OtherActor))
-		return;
-
-	FHitResult BoxHit;
-	BoxTrace(BoxHit);
-
-	if (BoxHit.GetActor()) 
-	{
-		if (ActorIsSameType(Type, BoxHit.GetActor()))
-			return;
-
-		UGameplayStatics::ApplyDamage(BoxHit.GetActor(), Damage,
-			GetInstigator()->GetController(), this, UDamageType::StaticClass());
-
-		ExecuteGetHit(BoxHit);
-		CreateFields(BoxHit.ImpactPoint);
-	}
+	HitComponent->BeginSwing();
+}
 
+void AWeapon::EndSwing()
+{
+	HitComponent->EndSwing();
 }
 
-bool AWeapon::ActorIsSameType(const FName& Type, AActor* OtherActor)
+void AWeapon::OnWeaponHit(const FHitResult& Hit)
 {
-	return GetOwner()->ActorHasTag(Type) && OtherActor->ActorHasTag(Type);
+	CreateFields(Hit.ImpactPoint);
 }
 
 void AWeapon::Equip(USceneComponent* InParent, FName InSocketName, AActor* NewOwner, APawn* NewInstigator)
 {
 	SetOwner(NewOwner);
 	SetInstigator(NewInstigator);
+	StopHovering();
+	HitComponent->ResetSwingHits();
 	AttachMeshToSocket(InParent, InSocketName);
 	ItemState = EItemState::EIS_Equipped;
-	if (EquipSound && NewOwner->ActorHasTag("SlashCharacter"))
+	if (EquipSound && IGameplayTypeInterface::ActorHasAnyTypeFlags(NewOwner, EGameplayTypeFlags::EGTF_Player))
 	{
 		UGameplayStatics::PlaySoundAtLocation(this, EquipSound, GetActorLocation());
 	}
@@ -0,0 +1,239 @@
+#include "Items/Weapons/WeaponHitComponent.h"
+#include "MyProject/MyProject.h"
+#include "Components/BoxComponent.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Interfaces/HitInterface.h"
+#include "Combat/DamagePipelineSubsystem.h"
+
+UWeaponHitComponent::UWeaponHitComponent()
+{
+	//Only ticks while a swing is being traced
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	SwingObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_WorldDynamic));
+	SwingObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_PhysicsBody));
+	SwingObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECollisionChannel::ECC_Destructible));
+}
+
+void UWeaponHitComponent::SetHitVolume(UBoxComponent* InHitBox, USceneComponent* InTraceStart, USceneComponent* InTraceEnd)
+{
+	if (HitBox)
+		HitBox->OnComponentBeginOverlap.RemoveDynamic(this, &UWeaponHitComponent::OnBoxOverlap);
+
+	HitBox = InHitBox;
+	TraceStart = InTraceStart;
+	TraceEnd = InTraceEnd;
+
+	if (HitBox)
+		HitBox->OnComponentBeginOverlap.AddDynamic(this, &UWeaponHitComponent::OnBoxOverlap);
+}
+
+void UWeaponHitComponent::SetHitVolumeEnabled(ECollisionEnabled::Type CollisionEnabled)
+{
+	if (HitBox == nullptr) return;
+
+	HitBox->SetCollisionEnabled(CollisionEnabled);
+	if (CollisionEnabled == ECollisionEnabled::NoCollision)
+		EndSwing();
+	else
+		BeginSwing();
+}
+
+void UWeaponHitComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (bSwinging && bUseSwingTrace)
+		SweepSwing();
+}
+
+void UWeaponHitComponent::ResetSwingHits()
+{
+	SwingHits.Reset();
+	SwingIgnoreActors.Reset();
+	if (AActor* Weapon = GetOwner())
+	{
+		SwingIgnoreActors.Add(Weapon);
+		if (Weapon->GetOwner())
+			SwingIgnoreActors.Add(Weapon->GetOwner());
+	}
+}
+
+void UWeaponHitComponent::SetSettingsFromOwner()
+{
+	bSettingsFromOwner = true;
+}
+
+void UWeaponHitComponent::SetSwingSettings(bool bInUseSwingTrace, int32 InSwingSamples, const TArray<TEnumAsByte<EObjectTypeQuery>>& InSwingObjectTypes)
+{
+	bUseSwingTrace = bInUseSwingTrace;
+	SwingSamples = InSwingSamples;
+	SwingObjectTypes = InSwingObjectTypes;
+}
+
+void UWeaponHitComponent::SetTraceSettings(float InDamage, const FVector& InBoxTraceSize, bool bInShowDebug)
+{
+	Damage = InDamage;
+	BoxTraceSize = InBoxTraceSize;
+	bShowDebug = bInShowDebug;
+}
+
+void UWeaponHitComponent::BeginSwing()
+{
+	ResetSwingHits();
+	GetSwingSamples(PrevSwingSamples);
+	bSwinging = true;
+	SetComponentTickEnabled(bUseSwingTrace);
+}
+
+void UWeaponHitComponent::EndSwing()
+{
+	bSwinging = false;
+	SetComponentTickEnabled(false);
+}
+
+void UWeaponHitComponent::GetTraceEnds(FVector& OutStart, FVector& OutEnd) const
+{
+	if (TraceStart && TraceEnd)
+	{
+		OutStart = TraceStart->GetComponentLocation();
+		OutEnd = TraceEnd->GetComponentLocation();
+		return;
+	}
+	if (HitBox == nullptr)
+	{
+		OutStart = OutEnd = GetOwner()->GetActorLocation();
+		return;
+	}
+
+	const FTransform& BoxTransform = HitBox->GetComponentTransform();
+	if (TraceStartOffset.IsZero() && TraceEndOffset.IsZero())
+	{
+		const FVector HalfBlade(0.f, 0.f, HitBox->GetUnscaledBoxExtent().Z);
+		OutStart = BoxTransform.TransformPosition(-HalfBlade);
+		OutEnd = BoxTransform.TransformPosition(HalfBlade);
+		return;
+	}
+	OutStart = BoxTransform.TransformPosition(TraceStartOffset);
+	OutEnd = BoxTransform.TransformPosition(TraceEndOffset);
+}
+
+FQuat UWeaponHitComponent::GetTraceRotation() const
+{
+	if (TraceStart) return TraceStart->GetComponentQuat();
+	return HitBox ? HitBox->GetComponentQuat() : GetOwner()->GetActorQuat();
+}
+
+void UWeaponHitComponent::GetSwingSamples(TArray<FVector, TInlineAllocator<8>>& OutSamples) const
+{
+	FVector Start, End;
+	GetTraceEnds(Start, End);
+	const int32 NumSamples = FMath::Max(SwingSamples, 2);
+
+	OutSamples.SetNum(NumSamples, EAllowShrinking::No);
+	for (int32 i = 0; i < NumSamples; i++)
+	{
+		OutSamples[i] = FMath::Lerp(Start, End, float(i) / float(NumSamples - 1));
+	}
+}
+
+void UWeaponHitComponent::SweepSwing()
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_WeaponSweepSwing);
+
+	TArray<FVector, TInlineAllocator<8>> Samples;
+	GetSwingSamples(Samples);
+
+	const FRotator Orientation = GetTraceRotation().Rotator();
+	const EDrawDebugTrace::Type DebugTrace = bShowDebug ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None;
+
+	UKismetSystemLibrary::BoxTraceMultiForObjects(this, Samples[0], Samples.Last(), BoxTraceSize, Orientation,
+		SwingObjectTypes, false, SwingIgnoreActors, DebugTrace, SwingHitResults, true);
+	ProcessHits(SwingHitResults);
+
+	//At high play rates the blade can skip past a target between frames, so sweep each sample's path too
+	if (PrevSwingSamples.Num() == Samples.Num())
+	{
+		for (int32 i = 0; i < Samples.Num(); i++)
+		{
+			if (PrevSwingSamples[i].Equals(Samples[i])) continue;
+
+			UKismetSystemLibrary::BoxTraceMultiForObjects(this, PrevSwingSamples[i], Samples[i], BoxTraceSize, Orientation,
+				SwingObjectTypes, false, SwingIgnoreActors, DebugTrace, SwingHitResults, true);
+			ProcessHits(SwingHitResults);
+		}
+	}
+	PrevSwingSamples = Samples;
+}
+
+void UWeaponHitComponent::BoxTrace(FHitResult& BoxHit)
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_WeaponBoxTrace);
+
+	FVector Start, End;
+	GetTraceEnds(Start, End);
+
+	UKismetSystemLibrary::BoxTraceSingle(this, Start, End, BoxTraceSize,
+		GetTraceRotation().Rotator(), ETraceTypeQuery::TraceTypeQuery1,
+		false, SwingIgnoreActors,
+		bShowDebug ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None,
+		BoxHit, true);
+}
+
+void UWeaponHitComponent::OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_WeaponOnBoxOverlap);
+
+	//Swing traces run from TickComponent while the attack window is open
+	if (bUseSwingTrace) return;
+
+	if (ActorIsSameType(EGameplayTypeFlags::EGTF_Enemy, OtherActor))
+		return;
+
+	FHitResult BoxHit;
+	BoxTrace(BoxHit);
+
+	if (BoxHit.GetActor())
+	{
+		ProcessHit(BoxHit);
+	}
+}
+
+void UWeaponHitComponent::ProcessHits(const TArray<FHitResult>& Hits)
+{
+	for (const FHitResult& Hit : Hits)
+	{
+		ProcessHit(Hit);
+	}
+}
+
+void UWeaponHitComponent::ProcessHit(const FHitResult& Hit)
+{
+	AActor* HitActor = Hit.GetActor();
+	if (HitActor == nullptr || SwingHits.Contains(HitActor)) return;
+
+	//Allies and actors past a full registry only go on the ignore list, so they are not traced again and never take a registry slot
+	SwingIgnoreActors.AddUnique(HitActor);
+	if (ActorIsSameType(EGameplayTypeFlags::EGTF_Enemy, HitActor) || !SwingHits.Add(HitActor))
+		return;
+	INC_DWORD_STAT(STAT_WeaponHits);
+
+	AActor* Weapon = GetOwner();
+	AController* InstigatorController = Weapon->GetInstigator() ? Weapon->GetInstigator()->GetController() : nullptr;
+	if (UDamagePipelineSubsystem* DamagePipeline = GetWorld()->GetSubsystem<UDamagePipelineSubsystem>())
+	{
+		//Damage and the hit reaction are applied together with the frame's other hits
+		DamagePipeline->QueueHit(HitActor, Weapon->GetOwner(), InstigatorController, Weapon, Hit.ImpactPoint, Damage);
+	}
+	else
+	{
+		IHitInterface::DispatchHit(HitActor, Hit.ImpactPoint, Weapon->GetOwner(), Damage, InstigatorController, Weapon);
+	}
+	OnWeaponHit.Broadcast(Hit);
+}
+
+bool UWeaponHitComponent::ActorIsSameType(EGameplayTypeFlags Type, AActor* OtherActor) const
+{
+	return IGameplayTypeInterface::ActorHasAnyTypeFlags(GetOwner()->GetOwner(), Type) && IGameplayTypeInterface::ActorHasAnyTypeFlags(OtherActor, Type);
+}
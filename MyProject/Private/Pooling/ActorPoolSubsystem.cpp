@@ -0,0 +1,122 @@
+#include "Pooling/ActorPoolSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "Interfaces/PoolableInterface.h"
+#include "Engine/World.h"
+
+void UActorPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	for (const FSoftClassPath& ClassPath : PrewarmClasses)
+	{
+		if (UClass* Class = ClassPath.TryLoadClass<AActor>())
+		{
+			Prewarm(Class, PrewarmCount);
+		}
+	}
+}
+
+void UActorPoolSubsystem::Deinitialize()
+{
+	for (const TPair<TObjectPtr<UClass>, FActorPool>& Pool : Pools)
+	{
+		DEC_DWORD_STAT_BY(STAT_PooledActors, Pool.Value.FreeActors.Num());
+		TRACE_COUNTER_SUBTRACT(MyProject_PooledActors, Pool.Value.FreeActors.Num());
+	}
+	Pools.Empty();
+	FreeActorKeys.Empty();
+	Super::Deinitialize();
+}
+
+AActor* UActorPoolSubsystem::SpawnPooledActor(UClass* Class, const FTransform& Transform)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return GetWorld()->SpawnActor(Class, &Transform, SpawnParams);
+}
+
+AActor* UActorPoolSubsystem::AcquireActor(UClass* Class, const FTransform& Transform)
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_PoolAcquire);
+
+	if (Class == nullptr) return nullptr;
+
+	FActorPool* Pool = Pools.Find(Class);
+	while (Pool && Pool->FreeActors.Num() > 0)
+	{
+		AActor* Actor = Pool->FreeActors.Pop(EAllowShrinking::No);
+		FreeActorKeys.Remove(Actor);
+		MYPROJECT_DEC_GAUGE(PooledActors);
+		if (!IsValid(Actor)) continue;
+
+		Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+		Actor->SetActorHiddenInGame(false);
+		Actor->SetActorEnableCollision(true);
+		Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+		if (IPoolableInterface* Poolable = Cast<IPoolableInterface>(Actor))
+		{
+			Poolable->OnAcquiredFromPool();
+		}
+		return Actor;
+	}
+
+	return SpawnPooledActor(Class, Transform);
+}
+
+void UActorPoolSubsystem::Release(AActor* Actor)
+{
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_PoolRelease);
+
+	//Despawn can fire twice from one overlap dispatch, pooling the actor twice would hand it out twice
+	if (!IsValid(Actor) || FreeActorKeys.Contains(Actor)) return;
+
+	FActorPool& Pool = Pools.FindOrAdd(Actor->GetClass());
+	if (Pool.FreeActors.Num() >= MaxPoolSize)
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	if (IPoolableInterface* Poolable = Cast<IPoolableInterface>(Actor))
+	{
+		Poolable->OnReleasedToPool();
+	}
+
+	Actor->SetLifeSpan(0.f);
+	Actor->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+	Pool.FreeActors.Add(Actor);
+	FreeActorKeys.Add(Actor);
+	MYPROJECT_INC_GAUGE(PooledActors);
+}
+
+void UActorPoolSubsystem::Prewarm(UClass* Class, int32 Count)
+{
+	if (Class == nullptr) return;
+
+	const int32 NumToSpawn = FMath::Min(Count, MaxPoolSize) - GetNumFree(Class);
+	for (int32 i = 0; i < NumToSpawn; i++)
+	{
+		Release(SpawnPooledActor(Class, FTransform::Identity));
+	}
+}
+
+int32 UActorPoolSubsystem::GetNumFree(UClass* Class) const
+{
+	const FActorPool* Pool = Pools.Find(Class);
+	return Pool ? Pool->FreeActors.Num() : 0;
+}
+
+void UActorPoolSubsystem::ReleaseOrDestroy(AActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+
+	UActorPoolSubsystem* ActorPool = Actor->GetWorld() ? Actor->GetWorld()->GetSubsystem<UActorPoolSubsystem>() : nullptr;
+	if (ActorPool)
+		ActorPool->Release(Actor);
+	else
+		Actor->Destroy();
+}
@@ -0,0 +1,547 @@
+#include "Stress/CombatStressSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "AI/ChaseFlowFieldSubsystem.h"
+#include "AI/EnemyAISubsystem.h"
+#include "AI/EnemyPerceptionSubsystem.h"
+#include "AI/EnemySignificanceSubsystem.h"
+#include "Breakable/BreakableActor.h"
+#include "Characters/SlashCharacter.h"
+#include "Combat/DamagePipelineSubsystem.h"
+#include "Effects/EffectsBudgetSubsystem.h"
+#include "Enemy/CorpseSubsystem.h"
+#include "Enemy/Enemy.h"
+#include "Interfaces/GameplayTypeInterface.h"
+#include "Items/ItemHoverSubsystem.h"
+#include "Items/LootSubsystem.h"
+#include "Items/Weapons/Weapon.h"
+#include "Pooling/ActorPoolSubsystem.h"
+#include "Timers/GameplayTimerSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "RenderCore.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogCombatStress, Log, All);
+
+namespace
+{
+	template<typename T>
+	double GetTickSeconds(const UWorld* World)
+	{
+		const T* Subsystem = World->GetSubsystem<T>();
+		return Subsystem ? Subsystem->GetLastTickSeconds() : 0.0;
+	}
+
+	struct FTimedSubsystem
+	{
+		const TCHAR* Name;
+		double (*GetSeconds)(const UWorld*);
+	};
+
+	//Report names and readers of every subsystem sampled each frame
+	const FTimedSubsystem TimedSubsystems[] =
+	{
+		{ TEXT("enemyAI"), &GetTickSeconds<UEnemyAISubsystem> },
+		{ TEXT("enemyPerception"), &GetTickSeconds<UEnemyPerceptionSubsystem> },
+		{ TEXT("enemySignificance"), &GetTickSeconds<UEnemySignificanceSubsystem> },
+		{ TEXT("chaseFlowField"), &GetTickSeconds<UChaseFlowFieldSubsystem> },
+		{ TEXT("gameplayTimers"), &GetTickSeconds<UGameplayTimerSubsystem> },
+		{ TEXT("damagePipeline"), &GetTickSeconds<UDamagePipelineSubsystem> },
+		{ TEXT("effectsBudget"), &GetTickSeconds<UEffectsBudgetSubsystem> },
+		{ TEXT("corpses"), &GetTickSeconds<UCorpseSubsystem> },
+		{ TEXT("loot"), &GetTickSeconds<ULootSubsystem> },
+		{ TEXT("itemHover"), &GetTickSeconds<UItemHoverSubsystem> },
+	};
+	constexpr int32 NumTimedSubsystems = UE_ARRAY_COUNT(TimedSubsystems);
+}
+
+void FCombatStressSettings::Parse(const TCHAR* Args)
+{
+	FParse::Value(Args, TEXT("Enemies="), NumEnemies);
+	FParse::Value(Args, TEXT("Breakables="), NumBreakables);
+	FParse::Value(Args, TEXT("Souls="), NumSouls);
+	FParse::Value(Args, TEXT("Duration="), Duration);
+	FParse::Value(Args, TEXT("Radius="), SpawnRadius);
+	FParse::Value(Args, TEXT("Seed="), Seed);
+	FParse::Value(Args, TEXT("Output="), OutputPath);
+
+	TArray<FString> Tokens;
+	FString(Args).ParseIntoArrayWS(Tokens);
+	bQuitWhenDone |= Tokens.Contains(TEXT("Quit"));
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs StressRunCommand(
+	TEXT("Stress.Run"),
+	TEXT("Runs the combat stress benchmark. Stress.Run [Enemies=N] [Breakables=N] [Souls=N] [Duration=Seconds] [Radius=N] [Seed=N] [Output=Path] [Quit]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UCombatStressSubsystem* Stress = World ? World->GetSubsystem<UCombatStressSubsystem>() : nullptr;
+		if (Stress == nullptr) return;
+
+		FCombatStressSettings Settings;
+		Settings.Parse(*FString::Join(Args, TEXT(" ")));
+		Stress->StartRun(Settings);
+	}));
+
+static FAutoConsoleCommandWithWorld StressStopCommand(
+	TEXT("Stress.Stop"),
+	TEXT("Ends the running combat stress benchmark early and writes its report"),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UCombatStressSubsystem* Stress = World ? World->GetSubsystem<UCombatStressSubsystem>() : nullptr)
+		{
+			Stress->StopRun();
+		}
+	}));
+#endif
+
+#if WITH_DEV_AUTOMATION_TESTS
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FWaitForCombatStressCommand, TWeakObjectPtr<UCombatStressSubsystem>, Stress);
+
+bool FWaitForCombatStressCommand::Update()
+{
+	return !Stress.IsValid() || !Stress->IsRunning();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatStressAutomationTest, "MyProject.Stress.Combat",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FCombatStressAutomationTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = nullptr;
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		if (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE)
+		{
+			World = Context.World();
+			break;
+		}
+	}
+	UCombatStressSubsystem* Stress = World ? World->GetSubsystem<UCombatStressSubsystem>() : nullptr;
+	if (!TestNotNull(TEXT("Combat stress subsystem of the game world"), Stress)) return false;
+
+	//Own switch so -CombatStress doesn't also start a run on begin play, the automation run decides when to quit
+	FString CommandLineArgs;
+	FParse::Value(FCommandLine::Get(), TEXT("CombatStressTest="), CommandLineArgs, false);
+	FCombatStressSettings Settings;
+	Settings.Parse(*CommandLineArgs);
+	Settings.bQuitWhenDone = false;
+	Stress->StartRun(Settings);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForCombatStressCommand(Stress));
+	return true;
+}
+#endif
+
+bool UCombatStressSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UCombatStressSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	FString CommandLineArgs;
+	const bool bHasArgs = FParse::Value(FCommandLine::Get(), TEXT("CombatStress="), CommandLineArgs, false);
+	if (!bHasArgs && !FParse::Param(FCommandLine::Get(), TEXT("CombatStress"))) return;
+
+	FCombatStressSettings CommandLineSettings;
+	CommandLineSettings.Parse(*CommandLineArgs);
+
+	//Players are only spawned once the match starts, give them a frame before looking for one
+	InWorld.GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, CommandLineSettings]()
+	{
+		StartRun(CommandLineSettings);
+	}));
+}
+
+void UCombatStressSubsystem::Deinitialize()
+{
+	if (bRunning) StopRun();
+	Super::Deinitialize();
+}
+
+TStatId UCombatStressSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatStressSubsystem, STATGROUP_MyProject);
+}
+
+void UCombatStressSubsystem::StartRun(const FCombatStressSettings& InSettings)
+{
+	if (bRunning) StopRun();
+
+	Settings = InSettings;
+	Stream.Initialize(Settings.Seed);
+	Samples.Reset();
+	Samples.Reserve(FMath::CeilToInt(Settings.Duration * 120.f));
+	SubsystemSeconds.Reset();
+	SubsystemSeconds.Reserve(Samples.Max() * NumTimedSubsystems);
+	StartMemory = PeakMemory = EndMemory = FMemorySample();
+	NextMemorySampleTime = 0.0;
+	SampleMemory();
+	StartMemory = PeakMemory;
+
+	SpawnActors();
+	SetupBot();
+
+	UE_LOG(LogCombatStress, Log, TEXT("Started: %d enemies, %d breakables, %d souls for %.1fs"),
+		Enemies.Num(), Breakables.Num(), Souls.Num(), Settings.Duration);
+
+	bRunning = true;
+	RunStartTime = GetWorld()->GetTimeSeconds();
+	LastFrameTime = 0.0;
+}
+
+void UCombatStressSubsystem::StopRun()
+{
+	if (!bRunning) return;
+	bRunning = false;
+
+	SampleMemory();
+	WriteReport();
+	CleanupActors();
+
+	if (Settings.bQuitWhenDone)
+	{
+		FPlatformMisc::RequestExit(false, TEXT("CombatStress"));
+	}
+}
+
+FVector UCombatStressSubsystem::GetSpawnLocation() const
+{
+	FVector Location(Stream.FRandRange(-1.f, 1.f) * Settings.SpawnRadius, Stream.FRandRange(-1.f, 1.f) * Settings.SpawnRadius, 0.f);
+
+	//Drop onto whatever floor the map has, maps without one spawn at the origin's height
+	FHitResult Hit;
+	if (GetWorld()->LineTraceSingleByChannel(Hit, Location + FVector(0.f, 0.f, 10000.f), Location - FVector(0.f, 0.f, 10000.f), ECollisionChannel::ECC_Visibility))
+	{
+		Location = Hit.ImpactPoint;
+	}
+	return Location + FVector(0.f, 0.f, 100.f);
+}
+
+void UCombatStressSubsystem::SpawnActors()
+{
+	UWorld* World = GetWorld();
+	UActorPoolSubsystem* ActorPool = World->GetSubsystem<UActorPoolSubsystem>();
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	if (UClass* Class = EnemyClass.TryLoadClass<AEnemy>())
+	{
+		for (int32 i = 0; i < Settings.NumEnemies; i++)
+		{
+			const FRotator Rotation(0.f, Stream.FRandRange(0.f, 360.f), 0.f);
+			const FVector Location = GetSpawnLocation();
+			//Enemies recycled by UCorpseSubsystem are reused
+			AEnemy* Enemy = ActorPool
+				? ActorPool->Acquire<AEnemy>(Class, FTransform(Rotation, Location))
+				: World->SpawnActor<AEnemy>(Class, Location, Rotation, SpawnParams);
+			if (Enemy)
+				Enemies.Add(Enemy);
+		}
+	}
+
+	if (UClass* Class = BreakableClass.TryLoadClass<ABreakableActor>())
+	{
+		for (int32 i = 0; i < Settings.NumBreakables; i++)
+		{
+			if (ABreakableActor* Breakable = World->SpawnActor<ABreakableActor>(Class, GetSpawnLocation(), FRotator::ZeroRotator, SpawnParams))
+				Breakables.Add(Breakable);
+		}
+	}
+
+	UClass* SoulActorClass = SoulClass.TryLoadClass<AActor>();
+	if (ActorPool && SoulActorClass)
+	{
+		for (int32 i = 0; i < Settings.NumSouls; i++)
+		{
+			if (AActor* Soul = ActorPool->AcquireActor(SoulActorClass, FTransform(GetSpawnLocation())))
+				Souls.Add(Soul);
+		}
+	}
+}
+
+void UCombatStressSubsystem::SetupBot()
+{
+	UWorld* World = GetWorld();
+	APlayerController* PlayerController = World->GetFirstPlayerController();
+	Bot = PlayerController ? Cast<ASlashCharacter>(PlayerController->GetPawn()) : nullptr;
+	bSpawnedBot = false;
+
+	if (Bot == nullptr)
+	{
+		UClass* Class = BotClass.TryLoadClass<ASlashCharacter>();
+		if (Class == nullptr) return;
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		Bot = World->SpawnActor<ASlashCharacter>(Class, FVector(0.f, 0.f, 200.f), FRotator::ZeroRotator, SpawnParams);
+		if (Bot == nullptr) return;
+
+		Bot->SpawnDefaultController();
+		bSpawnedBot = true;
+	}
+
+	UActorPoolSubsystem* ActorPool = World->GetSubsystem<UActorPoolSubsystem>();
+	UClass* WeaponClass = BotWeaponClass.TryLoadClass<AWeapon>();
+	if (ActorPool && WeaponClass && Bot->GetCharacterState() == ECharacterState::ECS_Unequipped)
+	{
+		if (AWeapon* Weapon = ActorPool->Acquire<AWeapon>(WeaponClass, Bot->GetActorTransform()))
+		{
+			Bot->SetOverlappingItem(Weapon);
+			Bot->EKeyPressed();
+		}
+	}
+	BotTarget = nullptr;
+	BotRetargetTime = 0.f;
+}
+
+void UCombatStressSubsystem::TickBot(float DeltaTime)
+{
+	if (!IsValid(Bot) || IGameplayTypeInterface::ActorHasAnyTypeFlags(Bot, EGameplayTypeFlags::EGTF_Dead)) return;
+
+	const FVector BotLocation = Bot->GetActorLocation();
+	BotRetargetTime -= DeltaTime;
+	if (BotRetargetTime <= 0.f || !IsValid(BotTarget) || IGameplayTypeInterface::ActorHasAnyTypeFlags(BotTarget, EGameplayTypeFlags::EGTF_Dead))
+	{
+		BotRetargetTime = BotRetargetInterval;
+		BotTarget = nullptr;
+		double ClosestDistanceSquared = TNumericLimits<double>::Max();
+		for (AEnemy* Enemy : Enemies)
+		{
+			if (!IsValid(Enemy) || IGameplayTypeInterface::ActorHasAnyTypeFlags(Enemy, EGameplayTypeFlags::EGTF_Dead)) continue;
+
+			const double DistanceSquared = FVector::DistSquared2D(BotLocation, Enemy->GetActorLocation());
+			if (DistanceSquared < ClosestDistanceSquared)
+			{
+				ClosestDistanceSquared = DistanceSquared;
+				BotTarget = Enemy;
+			}
+		}
+	}
+	if (BotTarget == nullptr) return;
+
+	const FVector ToTarget = BotTarget->GetActorLocation() - BotLocation;
+	const FVector Direction = ToTarget.GetSafeNormal2D();
+	if (ToTarget.SizeSquared2D() > FMath::Square(BotAttackRange))
+	{
+		Bot->AddMovementInput(Direction);
+	}
+	else
+	{
+		Bot->SetActorRotation(Direction.Rotation());
+		Bot->Attack();
+	}
+}
+
+void UCombatStressSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	const double Now = FPlatformTime::Seconds();
+	if (LastFrameTime > 0.0)
+	{
+		//Frame time includes the -fps limiter and render thread waits, game thread time is only the work.
+		//Both are from the previous frame, this one hasn't finished yet
+		FFrameSample& Sample = Samples.AddDefaulted_GetRef();
+		Sample.FrameSeconds = Now - LastFrameTime;
+		Sample.GameThreadSeconds = FPlatformTime::ToSeconds(GGameThreadTime);
+		for (const FTimedSubsystem& Timed : TimedSubsystems)
+		{
+			SubsystemSeconds.Add(Timed.GetSeconds(World));
+		}
+	}
+	LastFrameTime = Now;
+
+	if (Now >= NextMemorySampleTime)
+		SampleMemory();
+
+	TickBot(DeltaTime);
+
+	if (World->GetTimeSeconds() - RunStartTime >= Settings.Duration)
+		StopRun();
+}
+
+void UCombatStressSubsystem::SampleMemory()
+{
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	EndMemory.UsedPhysical = MemoryStats.UsedPhysical;
+	EndMemory.UsedVirtual = MemoryStats.UsedVirtual;
+	PeakMemory.UsedPhysical = FMath::Max(PeakMemory.UsedPhysical, EndMemory.UsedPhysical);
+	PeakMemory.UsedVirtual = FMath::Max(PeakMemory.UsedVirtual, EndMemory.UsedVirtual);
+	NextMemorySampleTime = FPlatformTime::Seconds() + MemorySampleInterval;
+}
+
+namespace
+{
+	double ToMB(uint64 Bytes)
+	{
+		return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+	}
+
+	void WriteTimings(TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>& Writer, const FString& Name, TArray<double>& Seconds)
+	{
+		Writer.WriteObjectStart(Name);
+		if (Seconds.Num() > 0)
+		{
+			Seconds.Sort();
+			double Total = 0.0;
+			for (double Value : Seconds)
+			{
+				Total += Value;
+			}
+			const auto Percentile = [&Seconds](double Fraction)
+			{
+				return Seconds[FMath::Min(FMath::FloorToInt(Fraction * Seconds.Num()), Seconds.Num() - 1)] * 1000.0;
+			};
+			Writer.WriteValue(TEXT("avg"), Total / Seconds.Num() * 1000.0);
+			Writer.WriteValue(TEXT("p50"), Percentile(0.5));
+			Writer.WriteValue(TEXT("p95"), Percentile(0.95));
+			Writer.WriteValue(TEXT("p99"), Percentile(0.99));
+			Writer.WriteValue(TEXT("max"), Seconds.Last() * 1000.0);
+		}
+		Writer.WriteObjectEnd();
+	}
+}
+
+void UCombatStressSubsystem::WriteReport() const
+{
+	UWorld* World = GetWorld();
+
+	int32 EnemiesAlive = 0;
+	for (const AEnemy* Enemy : Enemies)
+	{
+		if (IsValid(Enemy) && !IGameplayTypeInterface::ActorHasAnyTypeFlags(Enemy, EGameplayTypeFlags::EGTF_Dead))
+			EnemiesAlive++;
+	}
+	int32 BreakablesBroken = 0;
+	for (const ABreakableActor* Breakable : Breakables)
+	{
+		if (!IsValid(Breakable) || IGameplayTypeInterface::ActorHasAnyTypeFlags(Breakable, EGameplayTypeFlags::EGTF_Dead))
+			BreakablesBroken++;
+	}
+
+	TArray<double> FrameSeconds, GameThreadSeconds;
+	for (const FFrameSample& Sample : Samples)
+	{
+		FrameSeconds.Add(Sample.FrameSeconds);
+		GameThreadSeconds.Add(Sample.GameThreadSeconds);
+	}
+
+	const UEnemyAISubsystem* AI = World->GetSubsystem<UEnemyAISubsystem>();
+	const UItemHoverSubsystem* Hover = World->GetSubsystem<UItemHoverSubsystem>();
+
+	FString Json;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("map"), World->GetMapName());
+
+	Writer->WriteObjectStart(TEXT("settings"));
+	Writer->WriteValue(TEXT("enemies"), Settings.NumEnemies);
+	Writer->WriteValue(TEXT("breakables"), Settings.NumBreakables);
+	Writer->WriteValue(TEXT("souls"), Settings.NumSouls);
+	Writer->WriteValue(TEXT("duration"), Settings.Duration);
+	Writer->WriteValue(TEXT("radius"), Settings.SpawnRadius);
+	Writer->WriteValue(TEXT("seed"), Settings.Seed);
+	Writer->WriteObjectEnd();
+
+	Writer->WriteValue(TEXT("frames"), Samples.Num());
+	WriteTimings(*Writer, TEXT("frameMs"), FrameSeconds);
+	WriteTimings(*Writer, TEXT("gameThreadMs"), GameThreadSeconds);
+	Writer->WriteObjectStart(TEXT("subsystemMs"));
+	TArray<double> Seconds;
+	for (int32 Column = 0; Column < NumTimedSubsystems; Column++)
+	{
+		Seconds.Reset();
+		for (int32 Index = Column; Index < SubsystemSeconds.Num(); Index += NumTimedSubsystems)
+		{
+			Seconds.Add(SubsystemSeconds[Index]);
+		}
+		WriteTimings(*Writer, TimedSubsystems[Column].Name, Seconds);
+	}
+	Writer->WriteObjectEnd();
+
+	//Sampled over this run only, the platform peak values would include loading and earlier runs
+	Writer->WriteObjectStart(TEXT("memoryMB"));
+	Writer->WriteValue(TEXT("startPhysical"), ToMB(StartMemory.UsedPhysical));
+	Writer->WriteValue(TEXT("peakPhysical"), ToMB(PeakMemory.UsedPhysical));
+	Writer->WriteValue(TEXT("endPhysical"), ToMB(EndMemory.UsedPhysical));
+	Writer->WriteValue(TEXT("startVirtual"), ToMB(StartMemory.UsedVirtual));
+	Writer->WriteValue(TEXT("peakVirtual"), ToMB(PeakMemory.UsedVirtual));
+	Writer->WriteValue(TEXT("endVirtual"), ToMB(EndMemory.UsedVirtual));
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectStart(TEXT("spawned"));
+	Writer->WriteValue(TEXT("enemies"), Enemies.Num());
+	Writer->WriteValue(TEXT("breakables"), Breakables.Num());
+	Writer->WriteValue(TEXT("souls"), Souls.Num());
+	Writer->WriteValue(TEXT("bot"), Bot != nullptr);
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectStart(TEXT("end"));
+	Writer->WriteValue(TEXT("enemiesAlive"), EnemiesAlive);
+	Writer->WriteValue(TEXT("breakablesBroken"), BreakablesBroken);
+	Writer->WriteValue(TEXT("managedEnemies"), AI ? AI->GetNumEnemies() : 0);
+	Writer->WriteValue(TEXT("hoveringItems"), Hover ? Hover->GetNumItems() : 0);
+	Writer->WriteValue(TEXT("botAlive"), IsValid(Bot) && !IGameplayTypeInterface::ActorHasAnyTypeFlags(Bot, EGameplayTypeFlags::EGTF_Dead));
+	Writer->WriteObjectEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	const FString OutputPath = Settings.OutputPath.IsEmpty()
+		? FPaths::ProjectSavedDir() / TEXT("Profiling/CombatStress") / FString::Printf(TEXT("CombatStress-%s.json"), *FDateTime::Now().ToString())
+		: Settings.OutputPath;
+	if (FFileHelper::SaveStringToFile(Json, *OutputPath))
+		UE_LOG(LogCombatStress, Log, TEXT("Report written to %s"), *OutputPath);
+	else
+		UE_LOG(LogCombatStress, Error, TEXT("Could not write report to %s"), *OutputPath);
+}
+
+void UCombatStressSubsystem::CleanupActors()
+{
+	const UActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+	const auto IsPooled = [ActorPool](const AActor* Actor) { return ActorPool && ActorPool->IsPooled(Actor); };
+
+	//Enemies came from the pool and corpses already went back to it, the rest are returned for the next run
+	for (AEnemy* Enemy : Enemies)
+	{
+		if (IsValid(Enemy) && !IsPooled(Enemy))
+			UActorPoolSubsystem::ReleaseOrDestroy(Enemy);
+	}
+	for (ABreakableActor* Breakable : Breakables)
+	{
+		if (IsValid(Breakable)) Breakable->Destroy();
+	}
+	for (AActor* Soul : Souls)
+	{
+		//Souls the bot picked up are already back in the pool
+		if (IsValid(Soul) && !IsPooled(Soul))
+			UActorPoolSubsystem::ReleaseOrDestroy(Soul);
+	}
+	if (bSpawnedBot && IsValid(Bot))
+	{
+		Bot->Destroy();
+	}
+
+	Enemies.Reset();
+	Breakables.Reset();
+	Souls.Reset();
+	Bot = nullptr;
+	BotTarget = nullptr;
+}
@@ -0,0 +1,29 @@
+#include "Timers/GameplayTimerSubsystem.h"
+#include "MyProject/MyProject.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+
+void UGameplayTimerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	Wheel = FTimingWheel(TickSeconds);
+}
+
+void UGameplayTimerSubsystem::Deinitialize()
+{
+	Wheel.Reset();
+	Super::Deinitialize();
+}
+
+TStatId UGameplayTimerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGameplayTimerSubsystem, STATGROUP_MyProject);
+}
+
+void UGameplayTimerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	MYPROJECT_SCOPE_CYCLE_COUNTER(STAT_GameplayTimers);
+	LastTickSeconds = 0.0;
+	FScopedDurationTimer TickTimer(LastTickSeconds);
+	Wheel.Advance(DeltaTime);
+}
@@ -0,0 +1,179 @@
+#include "Timers/TimingWheel.h"
+
+FTimingWheel::FTimingWheel(float InTickSeconds)
+	: TickSeconds(FMath::Max(InTickSeconds, UE_KINDA_SMALL_NUMBER))
+{
+	Reset();
+}
+
+void FTimingWheel::Reset()
+{
+	Nodes.Reset();
+	FreeNodes.Reset();
+	Expired.Reset();
+	for (int32& Head : BucketHeads)
+	{
+		Head = INDEX_NONE;
+	}
+	NumActive = 0;
+	Accumulator = 0.f;
+	CurrentTick = 0;
+}
+
+FGameplayTimerHandle FTimingWheel::Schedule(float Delay, FTimerDelegate Delegate)
+{
+	const int32 NodeIndex = FreeNodes.Num() > 0 ? FreeNodes.Pop(EAllowShrinking::No) : Nodes.AddDefaulted();
+	FNode& Node = Nodes[NodeIndex];
+	Node.Delegate = MoveTemp(Delegate);
+	//Never fire on the tick it was scheduled, even with a zero delay
+	Node.ExpireTick = CurrentTick + FMath::Max<uint64>(1, FMath::CeilToInt64(FMath::Max(Delay, 0.f) / TickSeconds));
+	Node.bActive = true;
+	NumActive++;
+
+	Link(NodeIndex);
+	return { NodeIndex, Node.Generation };
+}
+
+const FTimingWheel::FNode* FTimingWheel::FindNode(const FGameplayTimerHandle& Handle) const
+{
+	if (!Nodes.IsValidIndex(Handle.Index)) return nullptr;
+
+	const FNode& Node = Nodes[Handle.Index];
+	return Node.bActive && Node.Generation == Handle.Generation ? &Node : nullptr;
+}
+
+bool FTimingWheel::Cancel(FGameplayTimerHandle& Handle)
+{
+	const bool bWasActive = FindNode(Handle) != nullptr;
+	if (bWasActive)
+	{
+		Unlink(Handle.Index);
+		Release(Handle.Index);
+	}
+	Handle.Invalidate();
+	return bWasActive;
+}
+
+bool FTimingWheel::IsActive(const FGameplayTimerHandle& Handle) const
+{
+	return FindNode(Handle) != nullptr;
+}
+
+float FTimingWheel::GetRemaining(const FGameplayTimerHandle& Handle) const
+{
+	const FNode* Node = FindNode(Handle);
+	if (Node == nullptr) return -1.f;
+
+	//Expired timers waiting for their callback in the current Advance have nothing left
+	if (Node->ExpireTick <= CurrentTick) return 0.f;
+
+	return FMath::Max(0.f, (Node->ExpireTick - CurrentTick) * TickSeconds - Accumulator);
+}
+
+void FTimingWheel::Link(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	const uint64 Delta = Node.ExpireTick > CurrentTick ? Node.ExpireTick - CurrentTick : 0;
+
+	int32 Level = 0;
+	while (Level < NumLevels - 1 && Delta >= (uint64(1) << (SlotBits * (Level + 1))))
+	{
+		Level++;
+	}
+	//Timers past the top level's range park in it and are re-linked each time it cascades
+	const int32 Slot = static_cast<int32>((Node.ExpireTick >> (SlotBits * Level)) & (SlotsPerLevel - 1));
+	const int32 Bucket = Level * SlotsPerLevel + Slot;
+
+	Node.Bucket = Bucket;
+	Node.Prev = INDEX_NONE;
+	Node.Next = BucketHeads[Bucket];
+	if (Node.Next != INDEX_NONE)
+		Nodes[Node.Next].Prev = NodeIndex;
+	BucketHeads[Bucket] = NodeIndex;
+}
+
+void FTimingWheel::Unlink(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	if (Node.Bucket == INDEX_NONE) return;
+
+	if (Node.Prev != INDEX_NONE)
+		Nodes[Node.Prev].Next = Node.Next;
+	else
+		BucketHeads[Node.Bucket] = Node.Next;
+	if (Node.Next != INDEX_NONE)
+		Nodes[Node.Next].Prev = Node.Prev;
+
+	Node.Prev = INDEX_NONE;
+	Node.Next = INDEX_NONE;
+	Node.Bucket = INDEX_NONE;
+}
+
+void FTimingWheel::Release(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	Node.Delegate.Unbind();
+	Node.bActive = false;
+	Node.Generation++;
+	NumActive--;
+	FreeNodes.Add(NodeIndex);
+}
+
+void FTimingWheel::Cascade(int32 Level)
+{
+	const int32 Bucket = Level * SlotsPerLevel + static_cast<int32>((CurrentTick >> (SlotBits * Level)) & (SlotsPerLevel - 1));
+	int32 NodeIndex = BucketHeads[Bucket];
+	BucketHeads[Bucket] = INDEX_NONE;
+	while (NodeIndex != INDEX_NONE)
+	{
+		const int32 Next = Nodes[NodeIndex].Next;
+		Link(NodeIndex);
+		NodeIndex = Next;
+	}
+}
+
+void FTimingWheel::CollectExpired()
+{
+	//Higher levels first so a timer can drop several levels in one tick
+	for (int32 Level = NumLevels - 1; Level > 0; Level--)
+	{
+		if ((CurrentTick & ((uint64(1) << (SlotBits * Level)) - 1)) == 0)
+			Cascade(Level);
+	}
+
+	const int32 Bucket = static_cast<int32>(CurrentTick & (SlotsPerLevel - 1));
+	int32 NodeIndex = BucketHeads[Bucket];
+	while (NodeIndex != INDEX_NONE)
+	{
+		FNode& Node = Nodes[NodeIndex];
+		const int32 Next = Node.Next;
+		if (Node.ExpireTick <= CurrentTick)
+		{
+			Unlink(NodeIndex);
+			Expired.Add({ NodeIndex, Node.Generation });
+		}
+		NodeIndex = Next;
+	}
+}
+
+void FTimingWheel::Advance(float DeltaSeconds)
+{
+	Accumulator += DeltaSeconds;
+	while (Accumulator >= TickSeconds)
+	{
+		Accumulator -= TickSeconds;
+		CurrentTick++;
+		CollectExpired();
+	}
+
+	//Callbacks may schedule or cancel, a cancelled entry no longer matches its node's generation
+	for (int32 i = 0; i < Expired.Num(); i++)
+	{
+		if (FindNode(Expired[i]) == nullptr) continue;
+
+		const FTimerDelegate Delegate = MoveTemp(Nodes[Expired[i].Index].Delegate);
+		Release(Expired[i].Index);
+		Delegate.ExecuteIfBound();
+	}
+	Expired.Reset();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ANavigationData;
+
+/**
+ * Square grid of world-aligned cells around one chase target. Each cell stores whether
+ * it projects onto the navmesh, its travel cost to the goal cell and the neighbour to
+ * step to next, so any number of chasers can steer from one integration pass.
+ */
+struct MYPROJECT_API FChaseFlowField
+{
+	explicit FChaseFlowField(int32 InDimension = 64, float InCellSize = 100.f);
+
+	//Moves the grid so Location sits in the middle, walkability of cells that stay covered is kept
+	void Recenter(const FVector& Location);
+
+	//Projects up to MaxSamples unsampled cells at Height, returns how many were sampled
+	int32 SampleWalkability(const ANavigationData& NavData, float Height, const FVector& Extent, int32 MaxSamples);
+
+	//Rebuilds costs and directions toward Goal, unsampled cells count as walkable
+	void Integrate(const FVector& Goal);
+
+	//Tracks the target inside its current cell without re-integrating
+	FORCEINLINE void SetGoalLocation(const FVector& Goal) { GoalLocation = Goal; }
+
+	//Unit XY direction toward the goal, false outside the grid or when the goal can't be reached
+	bool GetDirection(const FVector& Location, FVector& OutDirection) const;
+
+	bool Contains(const FVector& Location) const;
+
+	FORCEINLINE FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+	}
+
+	FORCEINLINE FIntPoint GetCenterCell() const { return OriginCell + FIntPoint(Dimension / 2, Dimension / 2); }
+
+	FORCEINLINE bool HasUnsampledCells() const { return NumUnsampled > 0; }
+
+private:
+	enum class ECellState : uint8
+	{
+		Unsampled,
+		Walkable,
+		Blocked
+	};
+
+	static constexpr uint8 NoDirection = 0xFF;
+	static constexpr uint32 Unreachable = MAX_uint32;
+
+	FORCEINLINE int32 ToIndex(const FIntPoint& Cell) const
+	{
+		const FIntPoint Local = Cell - OriginCell;
+		if (Local.X < 0 || Local.Y < 0 || Local.X >= Dimension || Local.Y >= Dimension) return INDEX_NONE;
+		return Local.Y * Dimension + Local.X;
+	}
+
+	FORCEINLINE bool IsPassable(int32 Index) const { return States[Index] != ECellState::Blocked; }
+
+	//Diagonal steps may not cut the corner of a blocked cell
+	bool CanStep(int32 X, int32 Y, int32 Direction) const;
+
+	int32 Dimension;
+	float CellSize;
+
+	//World cell of the grid's min corner
+	FIntPoint OriginCell = FIntPoint(0, 0);
+
+	FVector GoalLocation = FVector::ZeroVector;
+	int32 GoalIndex = INDEX_NONE;
+
+	TArray<ECellState> States;
+	TArray<uint32> Costs;
+	TArray<uint8> Directions;
+
+	int32 NumUnsampled = 0;
+	int32 SampleCursor = 0;
+
+	struct FOpenCell
+	{
+		uint32 Cost;
+		int32 Index;
+
+		FORCEINLINE bool operator<(const FOpenCell& Other) const { return Cost < Other.Cost; }
+	};
+
+	TArray<FOpenCell> Open;
+};
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/ChaseFlowField.h"
+#include "ChaseFlowFieldSubsystem.generated.h"
+
+class AEnemy;
+
+/**
+ * Keeps one flow field per chased target and steers every chasing enemy from it, so
+ * navigation work scales with the number of targets rather than the number of chasers.
+ * Fields follow their target by shifting whole cells and only sample newly covered
+ * cells against the navmesh. Chasers outside a field fall back to a regular move request.
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UChaseFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+	//Returns false when the enemy starts off the field and should issue its own move request,
+	//it is switched over to steering once it reaches the field
+	bool StartChase(AEnemy* Enemy, AActor* Target);
+
+	void StopChase(AEnemy* Enemy);
+
+	FORCEINLINE int32 GetNumChasers() const { return Chasers.Num(); }
+
+	FORCEINLINE int32 GetNumFields() const { return Fields.Num(); }
+
+private:
+	struct FTargetField
+	{
+		TWeakObjectPtr<AActor> Target;
+		FChaseFlowField Field;
+		FIntPoint GoalCell;
+		int32 NumChasers = 0;
+		float IdleTime = 0.f;
+		bool bDirty = true;
+	};
+
+	int32 FindOrAddField(AActor* Target);
+
+	//Drops the field and every chaser steering from it
+	void RemoveField(int32 FieldIndex);
+
+	void UpdateFields(float DeltaTime);
+
+	void SteerChasers();
+
+	void RemoveChaser(int32 Slot);
+
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemy>> Chasers;
+
+	//Index into Fields for each chaser
+	TArray<int32> ChaserFields;
+
+	//Chasers currently following a move request because they are off the field
+	TArray<bool> ChaserOnPath;
+
+	TArray<FTargetField> Fields;
+
+	/*
+		Fields
+	*/
+
+	//Cells along each side of a field
+	UPROPERTY(Config)
+	int32 FieldDimension = 64;
+
+	//Should stay below the width of the narrowest obstacle enemies must not cut through
+	UPROPERTY(Config)
+	float CellSize = 100.f;
+
+	//Navmesh projection box for each cell, kept under half a cell so gaps around walls read as blocked
+	UPROPERTY(Config)
+	FVector ProjectionExtent = FVector(30.f, 30.f, 250.f);
+
+	//Navmesh projections shared by all fields per tick
+	UPROPERTY(Config)
+	int32 MaxSamplesPerTick = 512;
+
+	//Cells the target may drift from the middle of its field before the field shifts
+	UPROPERTY(Config)
+	int32 RecenterCells = 8;
+
+	//Seconds a field is kept without chasers
+	UPROPERTY(Config)
+	float FieldTimeout = 2.f;
+
+	//Chasers stop steering this close to the target, same as the move request acceptance radius
+	UPROPERTY(Config)
+	float AcceptanceRadius = 75.f;
+
+	double LastTickSeconds = 0.0;
+};
@@ -0,0 +1,99 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/EnemyRangeClassifier.h"
+#include "EnemyAISubsystem.generated.h"
+
+class AEnemy;
+
+/**
+ * Drives every registered AEnemy's decision logic from one batched pass per frame.
+ * Enemies far from the player are updated less often, and the number of enemies
+ * updated per frame is capped so the cost stays bounded in big fights.
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UEnemyAISubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterEnemy(AEnemy* Enemy);
+	void UnregisterEnemy(AEnemy* Enemy);
+
+	//Floor for the enemy's update interval, set from its significance bucket
+	void SetDecisionInterval(AEnemy* Enemy, float Interval);
+
+	//Called when the enemy's archetype changes, registration reads the current radii
+	void SetRangeRadii(AEnemy* Enemy, const FEnemyRangeRadii& InRadii);
+
+	FORCEINLINE int32 GetNumEnemies() const { return Enemies.Num() - PendingRemovals; }
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+private:
+	void CompactSlots();
+
+	float GetUpdateInterval(double DistanceSquared) const;
+
+	bool GetFocusLocation(FVector& OutLocation) const;
+
+	/*
+		Decision inputs, one entry per slot. EEnemyState and the target stay on AEnemy, they are
+		written by hits, perception, montage notifies and blueprints, not only by the decision pass
+	*/
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemy>> Enemies;
+
+	TArray<FVector> Locations;
+
+	TArray<double> NextUpdateTimes;
+
+	TArray<float> DecisionIntervals;
+
+	TArray<FEnemyRangeRadii> Radii;
+
+	int32 UpdateCursor = 0;
+
+	/*
+		Per-frame scratch for the enemies due an update, reused to avoid allocating every tick
+	*/
+	TArray<int32> DueSlots;
+	TArray<FVector> DueTargets;
+	TArray<FVector> DueLocations;
+	TArray<FEnemyRangeRadii> DueRadii;
+	TArray<EEnemyRangeBand> DueBands;
+
+	int32 PendingRemovals = 0;
+
+	double LastTickSeconds = 0.0;
+
+	/*
+		Budgets
+	*/
+
+	//Max enemies whose decision logic runs in a single frame
+	UPROPERTY(Config)
+	int32 MaxUpdatesPerFrame = 64;
+
+	//Enemies closer than this update every frame
+	UPROPERTY(Config)
+	float NearDistance = 1500.f;
+
+	//Enemies further than this use FarUpdateInterval
+	UPROPERTY(Config)
+	float FarDistance = 5000.f;
+
+	UPROPERTY(Config)
+	float MidUpdateInterval = 0.1f;
+
+	UPROPERTY(Config)
+	float FarUpdateInterval = 0.5f;
+};
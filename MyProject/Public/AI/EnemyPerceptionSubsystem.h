@@ -0,0 +1,122 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/PawnSpatialHash.h"
+#include "WorldCollision.h"
+#include "EnemyPerceptionSubsystem.generated.h"
+
+class AEnemy;
+
+/**
+ * Shared sight sensing for enemies. Perceivable pawns go into a spatial hash rebuilt
+ * each frame, enemies query it for pawns inside their view cone on a staggered
+ * interval, and the resulting line of sight traces are submitted as async traces
+ * whose results reach the enemies on the following frame.
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UEnemyPerceptionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterPawn(APawn* Pawn);
+	void UnregisterPawn(APawn* Pawn);
+
+	void RegisterObserver(AEnemy* Observer, float SightRadius, float PeripheralVisionAngle);
+	void UnregisterObserver(AEnemy* Observer);
+
+	//Disabled observers keep their slot but are skipped until enabled again
+	void SetObserverSensing(AEnemy* Observer, bool bEnabled);
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+private:
+	struct FSightQuery
+	{
+		TWeakObjectPtr<AEnemy> Observer;
+		TWeakObjectPtr<APawn> Pawn;
+	};
+
+	void RebuildPawnHash();
+
+	void GatherSightQueries(double Now);
+
+	void SubmitSightTraces();
+
+	void DeliverSightResults();
+
+	void OnSightTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	void ReleaseSightQuery(const FSightQuery& Query);
+
+	FPawnSpatialHash PawnHash;
+
+	UPROPERTY()
+	TArray<TObjectPtr<APawn>> Pawns;
+
+	TArray<FVector> PawnLocations;
+
+	/*
+		Observers, one entry per registered enemy
+	*/
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemy>> Observers;
+
+	TArray<float> SightRadii;
+
+	TArray<float> CosHalfAngles;
+
+	TArray<double> NextSenseTimes;
+
+	//Consumed from PendingHead, the front is only dropped once it outweighs the rest
+	TArray<FSightQuery> PendingQueries;
+
+	int32 PendingHead = 0;
+
+	//Pending and in flight queries per observer, observers with any are not sensed again until they resolve
+	TMap<TWeakObjectPtr<AEnemy>, int32> OutstandingQueries;
+
+	//Submitted traces keyed by the UserData passed to the async trace
+	TMap<uint32, FSightQuery> InFlightQueries;
+
+	//Queries whose trace came back unblocked, delivered at the start of the next tick
+	TArray<FSightQuery> VisibleResults;
+
+	uint32 NextQueryId = 0;
+
+	FTraceDelegate SightTraceDelegate;
+
+	TArray<int32> NearbyPawns;
+
+	int32 SenseCursor = 0;
+
+	/*
+		Budgets
+	*/
+
+	//Seconds between two sight checks of the same enemy
+	UPROPERTY(Config)
+	float SensingInterval = 0.5f;
+
+	//Max enemies that query the hash in a single frame
+	UPROPERTY(Config)
+	int32 MaxObserversPerFrame = 128;
+
+	//Max line of sight traces submitted in a single frame, the rest carry over
+	UPROPERTY(Config)
+	int32 MaxSightTracesPerFrame = 32;
+
+	UPROPERTY(Config)
+	float CellSize = 1000.f;
+
+	double LastTickSeconds = 0.0;
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Characters/CharacterTypes.h"
+
+/**
+ * Squared radii for one enemy, expected to be nested (Attack <= Combat <= Patrol), UEnemyArchetype
+ * warns when they are not. A negative radius never matches, so an enemy with no target classifies as out of range.
+ */
+struct FEnemyRangeRadii
+{
+	double AttackRadiusSquared = -1.0;
+	double CombatRadiusSquared = -1.0;
+	double PatrolRadiusSquared = -1.0;
+
+	FEnemyRangeRadii() = default;
+
+	FEnemyRangeRadii(double AttackRadius, double CombatRadius, double PatrolRadius)
+		: AttackRadiusSquared(FMath::Square(AttackRadius)),
+		CombatRadiusSquared(FMath::Square(CombatRadius)),
+		PatrolRadiusSquared(FMath::Square(PatrolRadius))
+	{
+	}
+};
+
+/**
+ * Classifies enemies against their target into attack/combat/patrol/out-of-range bands
+ * using squared distances, four enemies per vector operation.
+ */
+struct MYPROJECT_API FEnemyRangeClassifier
+{
+	static EEnemyRangeBand Classify(const FVector& Location, const FVector& Target, const FEnemyRangeRadii& Radii);
+
+	//One shared target, e.g. every enemy against the player
+	static void ClassifyBatch(TArrayView<const FVector> Locations, const FVector& Target,
+		TArrayView<const FEnemyRangeRadii> Radii, TArrayView<EEnemyRangeBand> OutBands);
+
+	//One target per enemy
+	static void ClassifyBatch(TArrayView<const FVector> Locations, TArrayView<const FVector> Targets,
+		TArrayView<const FEnemyRangeRadii> Radii, TArrayView<EEnemyRangeBand> OutBands);
+
+	static FORCEINLINE bool IsWithin(EEnemyRangeBand Band, EEnemyRangeBand Limit) { return Band <= Limit; }
+};
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Characters/CharacterTypes.h"
+#include "EnemySignificanceSubsystem.generated.h"
+
+class AEnemy;
+
+//What an enemy is allowed to spend per frame in one significance bucket
+USTRUCT()
+struct FEnemySignificanceSettings
+{
+	GENERATED_BODY()
+
+	//Seconds between actor ticks, only used by enemies not driven by UEnemyAISubsystem
+	UPROPERTY(Config)
+	float ActorTickInterval = 0.f;
+
+	//Least seconds between decision updates in UEnemyAISubsystem, its distance intervals apply on top
+	UPROPERTY(Config)
+	float DecisionInterval = 0.f;
+
+	UPROPERTY(Config)
+	float MeshTickInterval = 0.f;
+
+	UPROPERTY(Config)
+	float MovementTickInterval = 0.f;
+
+	//Keep evaluating the anim graph while the mesh is off screen
+	UPROPERTY(Config)
+	bool bTickPoseWhenHidden = true;
+
+	UPROPERTY(Config)
+	bool bTickHealthWidget = true;
+
+	//Run sight checks in UEnemyPerceptionSubsystem
+	UPROPERTY(Config)
+	bool bSense = true;
+};
+
+/**
+ * Buckets enemies by distance to the player, off screen enemies count as further away.
+ * The closest enemies fill the High and Medium buckets up to their caps, so the number
+ * of enemies paying full animation, movement and widget cost stays fixed as fights grow.
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UEnemySignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UEnemySignificanceSubsystem();
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+	void RegisterEnemy(AEnemy* Enemy);
+	void UnregisterEnemy(AEnemy* Enemy);
+
+	const FEnemySignificanceSettings& GetSettings(EEnemySignificance Significance) const;
+
+private:
+	struct FSignificanceScore
+	{
+		double DistanceSquared;
+		int32 Index;
+	};
+
+	void Evaluate();
+
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemy>> Enemies;
+
+	TArray<FSignificanceScore> Scores;
+
+	float TimeUntilEvaluate = 0.f;
+
+	/*
+		Buckets
+	*/
+
+	UPROPERTY(Config)
+	float EvaluationInterval = 0.25f;
+
+	UPROPERTY(Config)
+	float HighDistance = 2000.f;
+
+	UPROPERTY(Config)
+	float MediumDistance = 5000.f;
+
+	UPROPERTY(Config)
+	float LowDistance = 10000.f;
+
+	//Enemies beyond these counts drop to the next bucket even when close enough
+	UPROPERTY(Config)
+	int32 MaxHighEnemies = 16;
+
+	UPROPERTY(Config)
+	int32 MaxMediumEnemies = 48;
+
+	//Distance multiplier for enemies that were not rendered recently
+	UPROPERTY(Config)
+	float OffscreenDistanceScale = 2.f;
+
+	UPROPERTY(Config)
+	float RenderedTimeout = 0.5f;
+
+	UPROPERTY(Config)
+	FEnemySignificanceSettings HighSettings;
+
+	UPROPERTY(Config)
+	FEnemySignificanceSettings MediumSettings;
+
+	UPROPERTY(Config)
+	FEnemySignificanceSettings LowSettings;
+
+	UPROPERTY(Config)
+	FEnemySignificanceSettings DormantSettings;
+
+	double LastTickSeconds = 0.0;
+};
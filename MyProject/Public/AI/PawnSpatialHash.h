@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform 2D grid over the XY plane. Entries are indices into a caller-owned array,
+ * so the hash can be rebuilt every frame without touching actors.
+ */
+struct MYPROJECT_API FPawnSpatialHash
+{
+	explicit FPawnSpatialHash(float InCellSize = 1000.f)
+		: CellSize(InCellSize)
+	{
+	}
+
+	void Reset();
+
+	void Add(int32 Index, const FVector& Location);
+
+	//Appends every index whose cell overlaps the sphere's XY footprint, callers do the exact distance test
+	void Query(const FVector& Center, float Radius, TArray<int32>& OutIndices) const;
+
+private:
+	FORCEINLINE FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+	}
+
+	float CellSize;
+
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> Cells;
+};
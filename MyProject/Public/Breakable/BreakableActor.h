@@ -5,12 +5,14 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Interfaces/HitInterface.h"
+#include "Interfaces/GameplayTypeInterface.h"
+#include "Items/LootTable.h"
 #include "BreakableActor.generated.h"
 
 class UGeometryCollectionComponent;
 struct FChaosBreakEvent;
 UCLASS()
-class MYPROJECT_API ABreakableActor : public AActor, public IHitInterface
+class MYPROJECT_API ABreakableActor : public AActor, public IHitInterface, public IGameplayTypeInterface
 {
 	GENERATED_BODY()
 	
@@ -19,6 +21,8 @@ public:
 	virtual void Tick(float DeltaTime) override;
 	virtual void GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter) override;
 
+	virtual EGameplayTypeFlags GetTypeFlags() const override;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -38,10 +42,18 @@ private:
 	UPROPERTY(EditAnywhere, Category = Sounds)
 	USoundBase* BreakSound;
 
+	//Used when no LootTable is set, breakables with the same list share one generated table
 	UPROPERTY(EditAnywhere, Category = "Breakable Properties")
 	TArray<TSubclassOf<class ATreasure>> TreasureClasses;
 
-	int32 DetermineDrop();
+	UPROPERTY(EditAnywhere, Category = "Breakable Properties")
+	TObjectPtr<ULootTable> LootTable;
+
+	//Seed for loot rolls, 0 picks a random seed on BeginPlay
+	UPROPERTY(EditAnywhere, Category = "Breakable Properties")
+	int32 LootSeed = 0;
+
+	FRandomStream LootStream;
 
 	void PlayBreakSound();
 
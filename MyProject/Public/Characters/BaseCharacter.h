@@ -3,13 +3,16 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "Interfaces/HitInterface.h"
+#include "Interfaces/GameplayTypeInterface.h"
 #include "Characters/CharacterTypes.h"
+#include "Characters/MontageSectionTable.h"
 #include "BaseCharacter.generated.h"
 
 class UAttributeComponent;
 class AWeapon;
+class UWeaponHitComponent;
 UCLASS()
-class MYPROJECT_API ABaseCharacter : public ACharacter, public IHitInterface
+class MYPROJECT_API ABaseCharacter : public ACharacter, public IHitInterface, public IGameplayTypeInterface
 {
 	GENERATED_BODY()
 
@@ -20,10 +23,23 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetWeaponCollisionEnabled(ECollisionEnabled::Type CollisionEnabled);
 
+	//Hit detection of whatever weapon is held, null when unarmed
+	virtual UWeaponHitComponent* GetWeaponHitComponent() const;
+
 	virtual void GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter) override;
 
+	virtual void ApplyResolvedDamage(float Damage, AController* EventInstigator, AActor* DamageCauser) override;
+
 	FORCEINLINE EDeathPose GetDeathPose() const { return DeathPose; }
 
+	virtual EGameplayTypeFlags GetTypeFlags() const override { return static_cast<EGameplayTypeFlags>(TypeFlags); }
+
+	UFUNCTION(BlueprintPure, Category = "Gameplay Type")
+	bool HasAnyTypeFlags(UPARAM(meta = (Bitmask, BitmaskEnum = "/Script/MyProject.EGameplayTypeFlags")) int32 Flags) const;
+
+	//Plays the directional hit react of every living character hit from ImpactPoint, e.g. by an area attack
+	static void ApplyHitReactions(TConstArrayView<ABaseCharacter*> Characters, const FVector& ImpactPoint);
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -51,8 +67,18 @@ protected:
 
 	void DisableCapsule();
 
-	int32 PlayRandomMontageSection(UAnimMontage* Montage, float PlayRate);
+	//Returns the 1 based section played, 0 when nothing played
+	int32 PlayRandomMontageSection(UAnimMontage* Montage, const FMontageSectionTable& Sections, float PlayRate);
 
+	void CacheMontageSections();
+
+	void AddTypeFlags(EGameplayTypeFlags Flags);
+
+	void RemoveTypeFlags(EGameplayTypeFlags Flags);
+
+	//Faction and state bits, queried through IGameplayTypeInterface instead of actor tags
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Gameplay Type", meta = (Bitmask, BitmaskEnum = "/Script/MyProject.EGameplayTypeFlags"))
+	int32 TypeFlags = 0;
 
 	UPROPERTY(BlueprintReadOnly)
 	AActor* CombatTarget;
@@ -75,11 +101,16 @@ protected:
 	UPROPERTY(BlueprintReadOnly)
 	EDeathPose DeathPose;
 
+	//Section names of the montages above, cached on BeginPlay
+	FMontageSectionTable AttackSections;
+	FMontageSectionTable DodgeSections;
+	FMontageSectionTable DeathSections;
+
 	virtual void PlayAttackMontage(float PlayRate = 1);
 
 	virtual void PlayDodgeMontage(float PlayRate = 1);
 
-	virtual void PlayHitReactMontage(const FName& SectionName);
+	virtual void PlayHitReactMontage(EHitDirection Direction);
 
 	virtual int32 PlayDeathMontage();
 
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "CharacterTypes.h"
+#include "CharacterAnimInstanceProxy.generated.h"
+
+class ABaseCharacter;
+class ASlashCharacter;
+class AEnemy;
+class UCharacterMovementComponent;
+
+/**
+ * Game thread snapshot of the owning character, taken once per frame in PreUpdate so
+ * the anim instances can run the rest of their update on worker threads.
+ */
+USTRUCT()
+struct MYPROJECT_API FCharacterAnimInstanceProxy : public FAnimInstanceProxy
+{
+	GENERATED_BODY()
+
+	FCharacterAnimInstanceProxy() = default;
+
+	FCharacterAnimInstanceProxy(UAnimInstance* InAnimInstance)
+		: FAnimInstanceProxy(InAnimInstance)
+	{
+	}
+
+	FVector Velocity = FVector::ZeroVector;
+	bool bIsFalling = false;
+	EDeathPose DeathPose = EDeathPose::EDP_Death1;
+
+	//Only filled for the matching owner type
+	ECharacterState CharacterState = ECharacterState::ECS_Unequipped;
+	EActionState ActionState = EActionState::EAS_Idle;
+	EEnemyState EnemyState = EEnemyState::EES_Idle;
+
+protected:
+	virtual void Initialize(UAnimInstance* InAnimInstance) override;
+	virtual void PreUpdate(UAnimInstance* InAnimInstance, float DeltaSeconds) override;
+
+private:
+	ABaseCharacter* Character = nullptr;
+	ASlashCharacter* SlashCharacter = nullptr;
+	AEnemy* Enemy = nullptr;
+	UCharacterMovementComponent* Movement = nullptr;
+};
@@ -36,4 +36,45 @@ enum class EDeathPose : uint8
 	EDP_Death1 UMETA(DisplayName = "Death1"),
 	EDP_Death2 UMETA(DisplayName = "Death2"),
 	EDP_Death3 UMETA(DisplayName = "Death3")
-};
\ No newline at end of file
+};
+
+UENUM(BlueprintType)
+enum class EEnemyRangeBand : uint8
+{
+	ERB_Attack UMETA(DisplayName = "Attack"),
+	ERB_Combat UMETA(DisplayName = "Combat"),
+	ERB_Patrol UMETA(DisplayName = "Patrol"),
+	ERB_OutOfRange UMETA(DisplayName = "Out Of Range")
+};
+
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EGameplayTypeFlags : uint8
+{
+	EGTF_None = 0 UMETA(Hidden),
+	EGTF_Player = 1 << 0 UMETA(DisplayName = "Player"),
+	EGTF_Enemy = 1 << 1 UMETA(DisplayName = "Enemy"),
+	EGTF_Dead = 1 << 2 UMETA(DisplayName = "Dead"),
+	EGTF_Item = 1 << 3 UMETA(DisplayName = "Item"),
+	EGTF_Breakable = 1 << 4 UMETA(DisplayName = "Breakable")
+};
+ENUM_CLASS_FLAGS(EGameplayTypeFlags);
+
+UENUM(BlueprintType)
+enum class EEnemySignificance : uint8
+{
+	ESL_High UMETA(DisplayName = "High"),
+	ESL_Medium UMETA(DisplayName = "Medium"),
+	ESL_Low UMETA(DisplayName = "Low"),
+	ESL_Dormant UMETA(DisplayName = "Dormant")
+};
+
+UENUM(BlueprintType)
+enum class EHitDirection : uint8
+{
+	EHD_Front UMETA(DisplayName = "Front"),
+	EHD_Left UMETA(DisplayName = "Left"),
+	EHD_Right UMETA(DisplayName = "Right"),
+	EHD_Back UMETA(DisplayName = "Back"),
+
+	EHD_MAX UMETA(Hidden)
+};
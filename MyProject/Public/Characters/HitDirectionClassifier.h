@@ -0,0 +1,21 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Characters/CharacterTypes.h"
+
+/**
+ * Sorts a hit into the 90 degree quadrant it came from, compared on the XY plane.
+ * Uses the dot and cross products of the unnormalized vectors instead of Acos:
+ * the hit is in front when dot >= |cross|, behind when -dot > |cross|, and the
+ * sign of cross picks right or left otherwise.
+ */
+struct MYPROJECT_API FHitDirectionClassifier
+{
+	static EHitDirection Classify(const FVector& Forward, const FVector& ToHit);
+
+	//Forwards, ToHits and OutDirections must have the same length
+	static void ClassifyBatch(TConstArrayView<FVector> Forwards, TConstArrayView<FVector> ToHits, TArrayView<EHitDirection> OutDirections);
+
+	//Hit react montage section for each direction, "FromFront", "FromLeft"...
+	static const FName& GetSectionName(EHitDirection Direction);
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimMontage.h"
+
+/**
+ * Section names of one montage, copied once so random picks don't go back to the
+ * montage's composite sections on every play.
+ */
+struct FMontageSectionTable
+{
+	void Build(const UAnimMontage* Montage)
+	{
+		Names.Reset();
+		if (Montage == nullptr) return;
+
+		for (int32 i = 0; i < Montage->GetNumSections(); i++)
+		{
+			Names.Add(Montage->GetSectionName(i));
+		}
+	}
+
+	//Index of a random section, INDEX_NONE when the montage has none
+	int32 PickRandom() const
+	{
+		return Names.Num() > 0 ? FMath::RandHelper(Names.Num()) : INDEX_NONE;
+	}
+
+	FORCEINLINE const FName& GetName(int32 Index) const { return Names[Index]; }
+	FORCEINLINE int32 Num() const { return Names.Num(); }
+
+private:
+	TArray<FName, TInlineAllocator<4>> Names;
+};
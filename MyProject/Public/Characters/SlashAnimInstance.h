@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Animation/AnimInstance.h"
 #include "CharacterTypes.h"
+#include "CharacterAnimInstanceProxy.h"
 #include "SlashAnimInstance.generated.h"
 
 /**
@@ -19,7 +20,9 @@ class MYPROJECT_API USlashAnimInstance : public UAnimInstance
 
 public:
 	virtual void NativeInitializeAnimation() override;
-	virtual void NativeUpdateAnimation(float DeltaTime) override;
+
+	//Runs on a worker thread, reads only the snapshot in Proxy
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaTime) override;
 
 	UPROPERTY(BlueprintReadOnly);
 	ASlashCharacter* SlashCharacter;
@@ -41,4 +44,12 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category = "Movement | State")
 	EDeathPose DeathPose;
+
+protected:
+	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override { return &Proxy; }
+	virtual void DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy) override {}
+
+private:
+	UPROPERTY(Transient)
+	FCharacterAnimInstanceProxy Proxy;
 };
@@ -27,12 +27,12 @@ class MYPROJECT_API ASlashCharacter : public ABaseCharacter, public IPickupInter
 
 public:
 	ASlashCharacter();
-	virtual void Tick(float DeltaTime) override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	
 	virtual void GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter) override;
 	bool IsDodging();
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
+	virtual void ApplyResolvedDamage(float Damage, AController* EventInstigator, AActor* DamageCauser) override;
 	
 	virtual void SetOverlappingItem(AItem* Item) override;
 	virtual void AddSouls(ASoul* Souls) override;
@@ -44,12 +44,13 @@ public:
 	virtual void Jump() override;
 	virtual void Attack() override;
 	void Dodge();
-	void UpdateStaminaBar();
 	void EKeyPressed();
 
 protected:
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void Die() override;
 
 	void InitializePlayerOverlay(APlayerController* PlayerController);
@@ -120,7 +121,7 @@ private:
 	UPROPERTY(VisibleInstanceOnly)
 	AItem* OverlappingItem;
 
-	void SetHUDHealth();
+	void SetPerceivable(bool bPerceivable);
 
 	class UPlayerOverlay* PlayerOverlay;
 
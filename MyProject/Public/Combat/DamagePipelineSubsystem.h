@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "DamagePipelineSubsystem.generated.h"
+
+//One hit reported by a weapon, resolved at the end of the frame
+struct FHitRecord
+{
+	TWeakObjectPtr<AActor> Target;
+	TWeakObjectPtr<AActor> Hitter;
+	TWeakObjectPtr<AController> Instigator;
+	TWeakObjectPtr<AActor> DamageCauser;
+	FVector ImpactPoint = FVector::ZeroVector;
+	float Amount = 0.f;
+	uint32 Sequence = 0;
+};
+
+/**
+ * Collects weapon hits for the frame and resolves them in one pass once physics has run.
+ * Repeat hits from the same damage causer on a target are dropped, the rest are summed
+ * into one IHitInterface::ApplyResolvedDamage call per target. Once every target's health
+ * has changed, each reacts once to its hardest hit through ReceiveResolvedHit.
+ */
+UCLASS()
+class MYPROJECT_API UDamagePipelineSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+	void QueueHit(AActor* Target, AActor* Hitter, AController* Instigator, AActor* DamageCauser, const FVector& ImpactPoint, float Amount);
+
+	FORCEINLINE int32 GetNumPendingHits() const { return PendingHits.Num(); }
+
+private:
+	struct FResolvedHit
+	{
+		//Index of the hardest hit in ResolvingHits, its impact point and hitter drive the reaction
+		int32 ReactionHit;
+		float TotalAmount;
+		uint32 FirstSequence;
+	};
+
+	void ResolveHits();
+
+	TArray<FHitRecord> PendingHits;
+
+	//Hits being resolved, reactions that queue new hits land in PendingHits for next frame
+	TArray<FHitRecord> ResolvingHits;
+
+	TArray<FResolvedHit> ResolvedHits;
+
+	uint32 NextSequence = 0;
+
+	double LastTickSeconds = 0.0;
+};
@@ -6,6 +6,8 @@
 #include "Components/ActorComponent.h"
 #include "AttributeComponent.generated.h"
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPercentAttributeChanged, float, Percent);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCountAttributeChanged, int32, Value);
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class MYPROJECT_API UAttributeComponent : public UActorComponent
@@ -14,15 +16,21 @@ class MYPROJECT_API UAttributeComponent : public UActorComponent
 
 public:	
 	UAttributeComponent();
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
-	void RegenStamina(float DeltaTime);
 
 	void ReceiveDamage(float Damage);
 
+	//Back to full health, used when a pooled character is reused
+	void RestoreHealth();
+
+	//Changes the cap and keeps the current health percent, used by enemy archetypes
+	void SetMaxHealth(float NewMaxHealth);
+
 	float GetHealthPercent();
 	float GetStaminaPercent();
 
+	//Stamina regenerates lazily, evaluated from the last change and the regen rate
+	float GetStamina() const;
+
 	bool IsAlive();
 
 	void UseStamina(float Cost);
@@ -33,10 +41,59 @@ public:
 	FORCEINLINE int32 GetSouls() const { return Souls; }
 	FORCEINLINE int32 GetDodgeCost() const { return DodgeCost; }
 
+	/*
+		Change events, coalesced so each fires at most once per frame.
+		Stamina only reports spending and filling up, regen in between is read through GetStamina
+	*/
+
+	UPROPERTY(BlueprintAssignable)
+	FOnPercentAttributeChanged OnHealthChanged;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnPercentAttributeChanged OnStaminaChanged;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnCountAttributeChanged OnGoldChanged;
+
+	UPROPERTY(BlueprintAssignable)
+	FOnCountAttributeChanged OnSoulsChanged;
+
 protected:
 	virtual void BeginPlay() override;
 
 private:
+	void MarkChanged(uint8 Attribute);
+
+	//Marks a percent attribute changed once it moved ChangeThreshold away from the last broadcast value or hit empty/full
+	void MarkPercentChanged(uint8 Attribute, float Percent, float LastBroadcastPercent);
+
+	void BroadcastChanges();
+
+	//Rebases the lazy stamina model at the current time
+	void SetStamina(float NewStamina);
+
+	void UpdateRegenTimer();
+
+	//One shot, rescheduled whenever stamina is spent
+	void OnStaminaFull();
+
+	double GetWorldTime() const;
+
+	//Time Stamina was last set, regen since then is added on read
+	double StaminaTimestamp = 0.0;
+
+	FTimerHandle StaminaRegenTimer;
+
+	uint8 ChangedAttributes = 0;
+
+	float LastBroadcastHealthPercent = -1.f;
+
+	float LastBroadcastStaminaPercent = -1.f;
+
+	//Smallest percent change that is worth an event, 0.01 = 1%
+	UPROPERTY(EditAnywhere, Category = "Actor Attributes")
+	float ChangeThreshold = 0.01f;
+
 	//Current Health
 	UPROPERTY(EditAnywhere, Category = "Actor Attributes")
 	float Health = 100.f;
@@ -44,6 +101,7 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Actor Attributes")
 	float MaxHealth = 100.f;
 
+	//Stamina at StaminaTimestamp, read it through GetStamina
 	UPROPERTY(EditAnywhere, Category = "Actor Attributes")
 	float Stamina = 100.f;
 
@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EffectsBudgetSubsystem.generated.h"
+
+class USoundBase;
+class UParticleSystem;
+class UNiagaraSystem;
+
+/**
+ * Throttles one-shot hit and pickup effects. Requests are queued during the frame and
+ * flushed together: requests for the same asset close to one another are merged, each
+ * asset has a limit on live instances and the whole flush has a spawn budget. Particle
+ * and Niagara components come from the engine's world pools via AutoRelease.
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UEffectsBudgetSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+	void RequestSound(USoundBase* Sound, const FVector& Location);
+
+	void RequestCascade(UParticleSystem* System, const FVector& Location);
+
+	void RequestNiagara(UNiagaraSystem* System, const FVector& Location);
+
+	//Queue on WorldContextObject's world, or play straight away when it has no budget subsystem
+	static void PlaySound(const UObject* WorldContextObject, USoundBase* Sound, const FVector& Location);
+
+	static void SpawnCascade(const UObject* WorldContextObject, UParticleSystem* System, const FVector& Location);
+
+	static void SpawnNiagara(const UObject* WorldContextObject, UNiagaraSystem* System, const FVector& Location);
+
+private:
+	enum class EEffectType : uint8
+	{
+		Sound,
+		Cascade,
+		Niagara
+	};
+
+	struct FEffectRequest
+	{
+		TWeakObjectPtr<UObject> Asset;
+		FVector Location;
+		EEffectType Type;
+	};
+
+	//Times at which the live instances of one asset are expected to finish
+	struct FEffectInstances
+	{
+		TArray<double, TInlineAllocator<8>> ExpireTimes;
+	};
+
+	void QueueRequest(UObject* Asset, const FVector& Location, EEffectType Type);
+
+	void Flush();
+
+	bool IsMerged(const FEffectRequest& Request) const;
+
+	int32 GetMaxConcurrent(const UObject* Asset) const;
+
+	float GetLifetime(const UObject* Asset, EEffectType Type) const;
+
+	void Spawn(UObject* Asset, const FVector& Location, EEffectType Type);
+
+	TArray<FEffectRequest> PendingRequests;
+
+	//Requests spawned by the current flush, used for merging
+	TArray<FEffectRequest> SpawnedRequests;
+
+	TMap<TWeakObjectPtr<UObject>, FEffectInstances> LiveInstances;
+
+	/*
+		Budget
+	*/
+
+	//Effects spawned per flush, the rest are dropped
+	UPROPERTY(Config)
+	int32 MaxSpawnsPerFrame = 16;
+
+	UPROPERTY(Config)
+	int32 MaxConcurrentPerEffect = 8;
+
+	//Per asset limits that replace MaxConcurrentPerEffect
+	UPROPERTY(Config)
+	TMap<FSoftObjectPath, int32> ConcurrencyOverrides;
+
+	//Requests for the same asset within this distance of a spawned one are dropped
+	UPROPERTY(Config)
+	float MergeRadius = 100.f;
+
+	//How long a particle effect counts toward its limit, sounds use their own duration
+	UPROPERTY(Config)
+	float EffectLifetime = 1.f;
+
+	double LastTickSeconds = 0.0;
+};
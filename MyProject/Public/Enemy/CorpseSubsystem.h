@@ -0,0 +1,62 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CorpseSubsystem.generated.h"
+
+class AEnemy;
+
+/**
+ * Owns dead enemies until they are recycled. Corpses lose their actor tick, movement,
+ * path following and widget as soon as they die and stop animating once the death
+ * pose settles. Only the newest MaxCorpses stay in the world, older ones and ones past
+ * CorpseLifetime go back to UActorPoolSubsystem along with their weapon.
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UCorpseSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Corpses.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return IsTickable() ? LastTickSeconds : 0.0; }
+
+	void AddCorpse(AEnemy* Enemy);
+
+	FORCEINLINE int32 GetNumCorpses() const { return Corpses.Num(); }
+
+private:
+	void RecycleCorpse(int32 Index);
+
+	//Oldest first
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemy>> Corpses;
+
+	TArray<double> DeathTimes;
+
+	TArray<bool> Settled;
+
+	/*
+		Budget
+	*/
+
+	UPROPERTY(Config)
+	int32 MaxCorpses = 16;
+
+	//Seconds before a corpse is recycled regardless of the budget, 0 keeps it until the budget pushes it out
+	UPROPERTY(Config)
+	float CorpseLifetime = 5.f;
+
+	//Seconds after death before the mesh stops ticking, should cover the longest death montage
+	UPROPERTY(Config)
+	float SettleTime = 2.5f;
+
+	double LastTickSeconds = 0.0;
+};
@@ -4,15 +4,21 @@
 
 #include "CoreMinimal.h"
 #include "Characters/BaseCharacter.h"
+#include "AI/EnemyRangeClassifier.h"
+#include "Enemy/EnemyArchetype.h"
+#include "Timers/TimingWheel.h"
+#include "Interfaces/PoolableInterface.h"
 #include "Enemy.generated.h"
 
 class UHealthBarComponent;
-class UPawnSensingComponent;
+class UEnemyAISubsystem;
+class UGameplayTimerSubsystem;
+struct FEnemySignificanceSettings;
 struct FAIRequestID;
 struct FPathFollowingResult;
 
 UCLASS()
-class MYPROJECT_API AEnemy : public ABaseCharacter
+class MYPROJECT_API AEnemy : public ABaseCharacter, public IPoolableInterface
 {
 	GENERATED_BODY()
 
@@ -24,15 +30,49 @@ public:
 
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
 
+	virtual void ReceiveResolvedHit(const FVector& ImpactPoint, AActor* Hitter, AController* EventInstigator) override;
+
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+
+	virtual UWeaponHitComponent* GetWeaponHitComponent() const override;
+
+	//Runs the combat/patrol state machine, called by UEnemyAISubsystem or from Tick when unmanaged
+	void UpdateAI(EEnemyRangeBand TargetBand);
+
+	//Combat target while fighting, patrol target otherwise
+	AActor* GetAITarget() const;
+
+	FORCEINLINE const FEnemyRangeRadii& GetRangeRadii() const { return GetArchetype().GetRangeRadii(); }
+
+	FORCEINLINE const UEnemyArchetype& GetArchetype() const { return Archetype ? *Archetype : *GetDefault<UEnemyArchetype>(); }
+
+	//Switches tuning at runtime, speed, health cap and perception are reapplied straight away
+	void SetArchetype(UEnemyArchetype* NewArchetype);
+
+	//Called by UEnemyPerceptionSubsystem once SeenPawn passed the view cone and line of sight checks
+	UFUNCTION()
+	void PawnSeen(APawn* SeenPawn);
+
+	//Applies the tick, animation, movement and sensing budget of a significance bucket
+	void SetSignificance(EEnemySignificance NewSignificance, const FEnemySignificanceSettings& Settings);
+
+	FORCEINLINE EEnemySignificance GetSignificance() const { return Significance; }
+
+	FORCEINLINE EEnemyState GetEnemyState() const { return EnemyState; }
 
 protected:
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void PostLoad() override;
+
 	virtual void Die() override;
 
 	void SpawnSoul();
 
-	bool InTargetRange(AActor* Target, double Radius);
+	EEnemyRangeBand ClassifyTarget(AActor* Target) const;
 
 	//Defined in blueprints
 	UFUNCTION(BlueprintImplementableEvent)
@@ -41,9 +81,6 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent)
 	void RotateTowardsPlayer(bool Rotate);
 
-	UFUNCTION()
-	void PawnSeen(APawn* SeenPawn);
-
 	void UnbindPatrolEvent();
 
 	void OnMoveCompleted(FAIRequestID RequestID, const FPathFollowingResult& Result);
@@ -74,8 +111,24 @@ protected:
 	EEnemyState EnemyState;
 
 private:
+	friend class UEnemyAISubsystem;
+	friend class UChaseFlowFieldSubsystem;
+	friend class UCorpseSubsystem;
+	friend class UEnemyPerceptionSubsystem;
+
 	void SetHealthBarVisibility(bool Visible);
 
+	void RegisterWithAIManager();
+
+	void UnregisterFromAIManager();
+
+	//Let UEnemyAISubsystem drive this enemy and disable its own tick
+	UPROPERTY(EditAnywhere, Category = "AI Navigation")
+	bool bUseAIManager = true;
+
+	//Slot in UEnemyAISubsystem, INDEX_NONE when unmanaged
+	int32 AISlot = INDEX_NONE;
+
 	void ChasePlayer();
 
 	void ClearPatrolTimer();
@@ -84,35 +137,75 @@ private:
 
 	void ClearAttackTimer();
 
+	//Attack and patrol timers run on the world's timing wheel rather than the timer manager
+	UGameplayTimerSubsystem* GetGameplayTimers() const;
+
 	UPROPERTY(EditAnywhere)
 	TSubclassOf<class AWeapon> WeaponClass;
 
+	//Slim weapon without pickup, hover or effect components, used instead of WeaponClass when set
+	UPROPERTY(EditAnywhere)
+	TSubclassOf<class AEnemyWeapon> HeldWeaponClass;
+
+	UPROPERTY()
+	class AEnemyWeapon* HeldWeapon;
+
 	UPROPERTY(EditAnywhere)
 	TSubclassOf<class ASoul> SoulClass;
 
-	FTimerHandle AttackTimer;
+	FGameplayTimerHandle AttackTimer;
+
+	//Ranges, speeds, timings and perception shared with every enemy of this kind
+	UPROPERTY(EditAnywhere, Category = "Archetype")
+	UEnemyArchetype* Archetype;
 
-	UPROPERTY(EditAnywhere, Category = "Combat")
+	//Pushes the archetype values that live on other objects: walk speed and max health
+	void ApplyArchetype();
+
+	/*
+	*	Legacy tuning
+	*/
+
+#if WITH_EDITORONLY_DATA
+	//Per enemy tuning from before archetypes, only loaded in the editor so old blueprints keep their values.
+	//PostLoad moves overridden values into an archetype shared by the class, assign an asset to drop them
+	UPROPERTY()
 	float AttackMin = 0.5f;
 
-	UPROPERTY(EditAnywhere, Category = "Combat")
+	UPROPERTY()
 	float AttackMax = 1.f;
 
-	UPROPERTY(EditAnywhere)
+	UPROPERTY()
 	double CombatRadius = 500.f;
 
-	UPROPERTY(EditAnywhere)
+	UPROPERTY()
 	double PatrolRadius = 1000.f;
 
-	UPROPERTY(EditAnywhere, Category = "Combat")
+	UPROPERTY()
 	double PatrolSpeed = 125.f;
 
-	UPROPERTY(EditAnywhere, Category = "Combat")
+	UPROPERTY()
 	double ChaseSpeed = 300.f;
 
-	UPROPERTY(EditAnywhere)
+	UPROPERTY()
 	double AttackRadius = 200.f;
 
+	UPROPERTY()
+	float WaitMin = 2.f;
+
+	UPROPERTY()
+	float WaitMax = 3.f;
+
+	UPROPERTY()
+	float SightRadius = 4000.f;
+
+	UPROPERTY()
+	float PeripheralVisionAngle = 90.f;
+
+	//False when every legacy field still has its default
+	bool MigrateLegacyTuning();
+#endif
+
 	class FDelegateHandle MoveCompleteHandle;
 
 	/*
@@ -122,8 +215,49 @@ private:
 	UPROPERTY(VisibleAnywhere)
 	UHealthBarComponent* HealthWidget;
 
-	UPROPERTY(VisibleAnywhere)
-	UPawnSensingComponent* PawnSensing;
+	/*
+	*	Perception
+	*/
+
+	void RegisterWithPerception();
+
+	void UnregisterFromPerception();
+
+	//Slot in UEnemyPerceptionSubsystem, INDEX_NONE when not observing
+	int32 PerceptionSlot = INDEX_NONE;
+
+	/*
+	*	Significance
+	*/
+
+	EEnemySignificance Significance = EEnemySignificance::ESL_High;
+
+	bool bTickHealthWidget = true;
+
+	void UpdateHealthWidgetTick();
+
+	void RegisterWithSignificance();
+
+	//Settings of the current bucket, null without a significance subsystem
+	const FEnemySignificanceSettings* GetSignificanceSettings() const;
+
+	void UnregisterFromSignificance();
+
+	/*
+	*	Corpse
+	*/
+
+	//Turns off everything a corpse doesn't need, the mesh keeps ticking so the death montage can finish
+	void StripForCorpse();
+
+	//Stops evaluating the mesh once the death pose has settled
+	void FreezeCorpsePose();
+
+	//Parked in UActorPoolSubsystem, not counted as a live enemy
+	bool bInPool = false;
+
+	//Returns held and equipped weapons to the pool
+	void ReleaseWeapons();
 
 	/*
 	*	Navigation
@@ -142,24 +276,30 @@ private:
 
 	TArray<AActor*> RemainingPatrolTargets;
 
-	FTimerHandle PatrolTimer;
+	FGameplayTimerHandle PatrolTimer;
 	void PatrolTimerFinished();
 
 	void BindPatrolEvent();
 
-	UPROPERTY(EditAnywhere, Category = "AI Navigation")
-	float WaitMin = 2.f;
+	void MoveToTarget(AActor* Target);
 
+	//Steer from the shared chase flow field instead of pathing to the combat target
 	UPROPERTY(EditAnywhere, Category = "AI Navigation")
-	float WaitMax = 3.f;
+	bool bUseChaseFlowField = true;
 
-	void MoveToTarget(AActor* Target);
+	//Slot in UChaseFlowFieldSubsystem, INDEX_NONE when not steering from a field
+	int32 ChaseSlot = INDEX_NONE;
+
+	//False when the enemy has to path to its combat target itself
+	bool StartFlowChase();
+
+	void StopFlowChase();
 
 	AActor* ChoosePatrolTarget();
 
-	void CheckCombatTarget();
+	void CheckCombatTarget(EEnemyRangeBand CombatBand);
 
-	void CheckPatrolTarget();
+	void CheckPatrolTarget(EEnemyRangeBand PatrolBand);
 
 	void StartPatrol();
 
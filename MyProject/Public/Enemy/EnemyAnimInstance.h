@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "Characters/CharacterTypes.h"
+#include "Characters/CharacterAnimInstanceProxy.h"
+#include "EnemyAnimInstance.generated.h"
+
+/**
+ * Base for enemy anim blueprints. Everything is read from the proxy snapshot so the
+ * update runs on worker threads alongside every other enemy.
+ */
+UCLASS()
+class MYPROJECT_API UEnemyAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaTime) override;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Movement")
+	float GroundSpeed;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Movement")
+	bool IsFalling;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Movement | State")
+	EEnemyState EnemyState;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Movement | State")
+	EDeathPose DeathPose;
+
+protected:
+	virtual FAnimInstanceProxy* CreateAnimInstanceProxy() override { return &Proxy; }
+	virtual void DestroyAnimInstanceProxy(FAnimInstanceProxy* InProxy) override {}
+
+private:
+	UPROPERTY(Transient)
+	FCharacterAnimInstanceProxy Proxy;
+};
@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "AI/EnemyRangeClassifier.h"
+#include "EnemyArchetype.generated.h"
+
+/**
+ * Tuning shared by every enemy of one kind. Enemies only hold a pointer to it and read most
+ * values when they need them, derived values (squared radii) are cached on the asset and rebuilt
+ * whenever it is loaded or edited. Walk speed, max health and sight are copied out when an enemy
+ * applies its archetype, editing the asset in the editor reapplies it to enemies in play.
+ * Enemies without an archetype read the class defaults.
+ */
+UCLASS(BlueprintType)
+class MYPROJECT_API UEnemyArchetype : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+
+	FORCEINLINE const FEnemyRangeRadii& GetRangeRadii() const { return RangeRadii; }
+
+	FORCEINLINE float GetPatrolSpeed() const { return PatrolSpeed; }
+	FORCEINLINE float GetChaseSpeed() const { return ChaseSpeed; }
+	FORCEINLINE float GetSightRadius() const { return SightRadius; }
+	FORCEINLINE float GetPeripheralVisionAngle() const { return PeripheralVisionAngle; }
+	FORCEINLINE float GetMaxHealth() const { return MaxHealth; }
+
+	FORCEINLINE float RandomAttackDelay() const { return FMath::RandRange(AttackMin, AttackMax); }
+	FORCEINLINE float RandomPatrolWait() const { return FMath::RandRange(WaitMin, WaitMax); }
+
+protected:
+	/*
+		Ranges, expected to be nested: Attack <= Combat <= Patrol, validation flags assets that aren't
+	*/
+
+	UPROPERTY(EditAnywhere, Category = "Ranges", meta = (ClampMin = "0"))
+	float AttackRadius = 200.f;
+
+	UPROPERTY(EditAnywhere, Category = "Ranges", meta = (ClampMin = "0"))
+	float CombatRadius = 500.f;
+
+	UPROPERTY(EditAnywhere, Category = "Ranges", meta = (ClampMin = "0"))
+	float PatrolRadius = 1000.f;
+
+	UPROPERTY(EditAnywhere, Category = "Movement")
+	float PatrolSpeed = 125.f;
+
+	UPROPERTY(EditAnywhere, Category = "Movement")
+	float ChaseSpeed = 300.f;
+
+	//Seconds between entering attack range and swinging
+	UPROPERTY(EditAnywhere, Category = "Combat")
+	float AttackMin = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category = "Combat")
+	float AttackMax = 1.f;
+
+	//Seconds spent at a patrol point
+	UPROPERTY(EditAnywhere, Category = "Patrol")
+	float WaitMin = 2.f;
+
+	UPROPERTY(EditAnywhere, Category = "Patrol")
+	float WaitMax = 3.f;
+
+	UPROPERTY(EditAnywhere, Category = "Perception")
+	float SightRadius = 4000.f;
+
+	//Half angle of the view cone in degrees
+	UPROPERTY(EditAnywhere, Category = "Perception")
+	float PeripheralVisionAngle = 90.f;
+
+	//0 keeps the attribute component's own max health
+	UPROPERTY(EditAnywhere, Category = "Attributes", meta = (ClampMin = "0"))
+	float MaxHealth = 0.f;
+
+private:
+	FORCEINLINE bool HasNestedRanges() const { return AttackRadius <= CombatRadius && CombatRadius <= PatrolRadius; }
+
+	//Fills generated archetypes from the per-enemy fields that predate archetypes
+	friend class AEnemy;
+
+	void RebuildCache();
+
+	FEnemyRangeRadii RangeRadii;
+};
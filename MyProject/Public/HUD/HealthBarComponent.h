@@ -15,7 +15,32 @@ class MYPROJECT_API UHealthBarComponent : public UWidgetComponent
 public:
 	void SetHealthPercent(float Percent);
 
+	virtual void InitWidget() override;
+
+	FORCEINLINE float GetHealthPercent() const { return HealthPercent; }
+	FORCEINLINE bool IsDrawnByHUD() const { return bDrawWithHUD; }
+
+protected:
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void OnVisibilityChanged() override;
+
 private:
+	friend class UHealthBarSubsystem;
+
+	//Let APlayerHUD draw this bar with every other one instead of creating a widget
+	UPROPERTY(EditAnywhere, Category = "Health Bar")
+	bool bDrawWithHUD = true;
+
 	UPROPERTY()
 	class UHealthBar* HealthBarWidget;
+
+	float HealthPercent = 1.f;
+
+	//Slot in UHealthBarSubsystem, INDEX_NONE while hidden
+	int32 BarSlot = INDEX_NONE;
+
+	void UpdateHUDBar();
 };
@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HealthBarSubsystem.generated.h"
+
+class UHealthBarComponent;
+
+/**
+ * Compact list of the health bars currently shown in the world. APlayerHUD draws
+ * them all in one canvas pass instead of each enemy rendering its own widget.
+ */
+UCLASS()
+class MYPROJECT_API UHealthBarSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	void AddBar(UHealthBarComponent* Bar);
+	void RemoveBar(UHealthBarComponent* Bar);
+	void SetPercent(const UHealthBarComponent* Bar, float Percent);
+
+	FORCEINLINE int32 GetNumBars() const { return Bars.Num(); }
+	FORCEINLINE const UHealthBarComponent* GetBar(int32 Index) const { return Bars[Index]; }
+	FORCEINLINE float GetPercent(int32 Index) const { return Percents[Index]; }
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<UHealthBarComponent>> Bars;
+
+	TArray<float> Percents;
+};
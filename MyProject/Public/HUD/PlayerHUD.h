@@ -18,12 +18,50 @@ class MYPROJECT_API APlayerHUD : public AHUD
 public:
 	FORCEINLINE UPlayerOverlay* GetPlayerOverlay() const { return PlayerOverlay; }
 
+	virtual void DrawHUD() override;
+
 protected:
 	virtual void BeginPlay() override;
 
 	virtual void PreInitializeComponents() override;
 
 private:
+	struct FVisibleHealthBar
+	{
+		FVector2D ScreenLocation;
+		double DistanceSquared;
+		float Percent;
+	};
+
+	//Draws every bar registered in UHealthBarSubsystem as two canvas tiles each
+	void DrawEnemyHealthBars();
+
+	TArray<FVisibleHealthBar> VisibleHealthBars;
+
+	/*
+		Enemy health bars
+	*/
+
+	//Only the closest bars are drawn past this count
+	UPROPERTY(EditDefaultsOnly, Category = "Health Bars")
+	int32 MaxHealthBars = 32;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Health Bars")
+	float MaxHealthBarDistance = 4000.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Health Bars")
+	FVector2D HealthBarSize = FVector2D(80.f, 8.f);
+
+	//World offset above the bar's component
+	UPROPERTY(EditDefaultsOnly, Category = "Health Bars")
+	float HealthBarHeight = 20.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Health Bars")
+	FLinearColor HealthBarColor = FLinearColor(0.8f, 0.05f, 0.05f);
+
+	UPROPERTY(EditDefaultsOnly, Category = "Health Bars")
+	FLinearColor HealthBarBackgroundColor = FLinearColor(0.f, 0.f, 0.f, 0.6f);
+
 
 	UPROPERTY(EditDefaultsOnly, Category = "Slash")
 	TSubclassOf<UPlayerOverlay> PlayerOverlayClass;
@@ -6,6 +6,27 @@
 #include "Blueprint/UserWidget.h"
 #include "PlayerOverlay.generated.h"
 
+/**
+ * Small ring of recently shown numbers and their FText, so counters that revisit
+ * values reuse the text and unchanged values skip SetText entirely.
+ */
+struct FNumberTextCache
+{
+	//False when Value is already the displayed value
+	bool Update(int32 Value, FText& OutText);
+
+private:
+	static constexpr int32 Capacity = 8;
+
+	int32 Values[Capacity];
+	FText Texts[Capacity];
+	int32 NumEntries = 0;
+	int32 NextSlot = 0;
+
+	int32 DisplayedValue = 0;
+	bool bHasDisplayed = false;
+};
+
 /**
  * 
  */
@@ -16,16 +37,29 @@ class MYPROJECT_API UPlayerOverlay : public UUserWidget
 	
 public:
 
+	//Subscribes to the attribute change events so the widgets only update when a value changes
+	void BindToAttributes(class UAttributeComponent* Attributes);
+
+	UFUNCTION()
 	void SetHealthBarPercent(float Percent);
 
+	UFUNCTION()
 	void SetStaminaBarPercent(float Percent);
 
+	UFUNCTION()
 	void SetGold(int32 Gold);
 
+	UFUNCTION()
 	void SetSouls(int32 Souls);
 
+protected:
+	//Follows stamina regen, the attribute component only reports when stamina is spent or full
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
 private:
 
+	TWeakObjectPtr<class UAttributeComponent> BoundAttributes;
+
 	UPROPERTY(meta = (BindWidget))
 	class UProgressBar* HealthProgressBar;
 
@@ -37,4 +71,12 @@ private:
 
 	UPROPERTY(meta = (BindWidget))
 	class UTextBlock* SoulText;
+
+	FNumberTextCache GoldTextCache;
+
+	FNumberTextCache SoulTextCache;
+
+	float DisplayedHealthPercent = -1.f;
+
+	float DisplayedStaminaPercent = -1.f;
 };
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Characters/CharacterTypes.h"
+#include "GameplayTypeInterface.generated.h"
+
+// This class does not need to be modified.
+UINTERFACE(MinimalAPI)
+class UGameplayTypeInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Cheap faction/state queries for overlap and sensing callbacks, replaces ActorHasTag lookups.
+ */
+class MYPROJECT_API IGameplayTypeInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual EGameplayTypeFlags GetTypeFlags() const;
+
+	//None for actors that don't implement the interface
+	static EGameplayTypeFlags GetActorTypeFlags(const AActor* Actor);
+
+	static bool ActorHasAnyTypeFlags(const AActor* Actor, EGameplayTypeFlags Flags);
+};
@@ -26,4 +26,21 @@ public:
 	UFUNCTION(BlueprintNativeEvent)
 	void GetHit(const FVector& ImpactPoint, AActor* Hitter);
 
+	/*
+		Resolved hits from UDamagePipelineSubsystem: every target takes its merged damage, then every target reacts once
+	*/
+
+	//Health only, the default goes through ApplyDamage
+	virtual void ApplyResolvedDamage(float Damage, AController* EventInstigator, AActor* DamageCauser);
+
+	//Reaction to the hardest hit, the default calls GetHit. Characters update widgets and state here
+	virtual void ReceiveResolvedHit(const FVector& ImpactPoint, AActor* Hitter, AController* EventInstigator);
+
+	//Blueprint only implementers get ApplyDamage and GetHit instead
+	static void DispatchDamage(AActor* Target, float Damage, AController* EventInstigator, AActor* DamageCauser);
+
+	static void DispatchReaction(AActor* Target, const FVector& ImpactPoint, AActor* Hitter, AController* EventInstigator);
+
+	//Both phases for a single hit
+	static void DispatchHit(AActor* Target, const FVector& ImpactPoint, AActor* Hitter, float Damage, AController* EventInstigator, AActor* DamageCauser);
 };
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "PoolableInterface.generated.h"
+
+// This class does not need to be modified.
+UINTERFACE(MinimalAPI)
+class UPoolableInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Reset hooks for actors recycled by UActorPoolSubsystem. Pooled actors only run
+ * BeginPlay once, so per-use state has to be restored here instead.
+ */
+class MYPROJECT_API IPoolableInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	//Called after the actor has been moved, shown and had collision restored
+	virtual void OnAcquiredFromPool();
+
+	//Called before the actor is hidden and parked in the pool
+	virtual void OnReleasedToPool();
+};
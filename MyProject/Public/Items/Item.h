@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Interfaces/GameplayTypeInterface.h"
+#include "Interfaces/PoolableInterface.h"
 #include "Item.generated.h"
 
 enum class EItemState : uint8 
@@ -14,7 +16,7 @@ enum class EItemState : uint8
 
 class USphereComponent;
 UCLASS()
-class MYPROJECT_API AItem : public AActor
+class MYPROJECT_API AItem : public AActor, public IGameplayTypeInterface, public IPoolableInterface
 {
 	GENERATED_BODY()
 	
@@ -22,10 +24,27 @@ public:
 	// Sets default values for this actor's properties
 	AItem();
 
+	virtual EGameplayTypeFlags GetTypeFlags() const override { return EGameplayTypeFlags::EGTF_Item; }
+
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
+
+	//Returns the item to the world's actor pool, or destroys it when there is none
+	void Despawn();
+
+	void DespawnAfter(float Delay);
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	//Hands the hover bob to UItemHoverSubsystem while the item sits in the world
+	void StartHovering();
+
+	void StopHovering();
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	UStaticMeshComponent* ItemMesh;
 
@@ -72,12 +91,15 @@ protected:
 	USoundBase* PickupSound;
 
 private:
+	FTimerHandle DespawnTimer;
 
+	/* Hover */
+	friend class UItemHoverSubsystem;
 
-public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
+	int32 HoverSlot = INDEX_NONE;
 
+	//Pickup sphere offset restored when hovering stops, the sphere stays put while the item bobs
+	FVector SphereRelativeLocation;
 };
 
 template<typename T>
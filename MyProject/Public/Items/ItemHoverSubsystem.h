@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemHoverSubsystem.generated.h"
+
+class AItem;
+
+/**
+ * Bobs every hovering AItem from one pass over packed arrays, so items don't need
+ * their own tick. Only items in EIS_Hovering are registered.
+ */
+UCLASS()
+class MYPROJECT_API UItemHoverSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterItem(AItem* Item, float Amplitude, float TimeConstant);
+
+	//Returns the item's hover time so it can be written back to the item
+	float UnregisterItem(AItem* Item);
+
+	FORCEINLINE int32 GetNumItems() const { return Items.Num() - PendingRemovals; }
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+private:
+	void CompactSlots();
+
+	UPROPERTY()
+	TArray<TObjectPtr<AItem>> Items;
+
+	TArray<FVector> BaseLocations;
+
+	TArray<float> RunningTimes;
+
+	//Peak offset of each item's bob, precomputed from its amplitude and time constant
+	TArray<float> HoverHeights;
+
+	TArray<float> TimeConstants;
+
+	int32 PendingRemovals = 0;
+
+	double LastTickSeconds = 0.0;
+};
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LootSubsystem.generated.h"
+
+class ATreasure;
+class ULootTable;
+
+/**
+ * Rolls the loot of every breakable that broke this frame in one pass, grouped by loot table,
+ * so a chain reaction costs one ULootTable::RollDropsBulk call per table. Also owns the tables
+ * generated for breakables that only list treasure classes, one per distinct list.
+ */
+UCLASS()
+class MYPROJECT_API ULootSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+	//Each break keeps its own stream so seeded breakables still roll the same drops
+	void QueueLoot(ULootTable* Table, const FRandomStream& Stream, const FTransform& DropTransform);
+
+	//Shared table for a breakable without a loot table asset, built the first time the list is seen
+	ULootTable* GetFallbackTable(const TArray<TSubclassOf<ATreasure>>& TreasureClasses);
+
+	FORCEINLINE int32 GetNumPendingLoot() const { return PendingLoot.Num(); }
+
+private:
+	struct FPendingLoot
+	{
+		TWeakObjectPtr<ULootTable> Table;
+		FRandomStream Stream;
+		FTransform DropTransform;
+	};
+
+	void RollPendingLoot();
+
+	void SpawnDrops(TConstArrayView<TSubclassOf<ATreasure>> BreakDrops, const FTransform& DropTransform);
+
+	TArray<FPendingLoot> PendingLoot;
+
+	//Loot being rolled, breaks caused by spawning it land in PendingLoot for next frame
+	TArray<FPendingLoot> RollingLoot;
+
+	TArray<FRandomStream> Streams;
+
+	TArray<TSubclassOf<ATreasure>> Drops;
+
+	TArray<int32> DropCounts;
+
+	UPROPERTY()
+	TArray<TObjectPtr<ULootTable>> FallbackTables;
+
+	double LastTickSeconds = 0.0;
+};
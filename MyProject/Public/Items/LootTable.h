@@ -0,0 +1,86 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "LootTable.generated.h"
+
+class ATreasure;
+
+/**
+ * Walker's alias method over a fixed set of weights. Building is O(n), each sample
+ * is one table lookup and two random numbers regardless of how many outcomes there are.
+ */
+struct MYPROJECT_API FAliasSampler
+{
+	//Zero and negative weights are never sampled
+	void Build(TConstArrayView<float> Weights);
+
+	void Reset();
+
+	//Index into the weights passed to Build, INDEX_NONE when nothing can be sampled
+	int32 Sample(const FRandomStream& Stream) const;
+
+	FORCEINLINE bool IsEmpty() const { return Probabilities.IsEmpty(); }
+
+private:
+	TArray<float> Probabilities;
+	TArray<int32> Aliases;
+
+	//Sampler slot to original weight index, zero weights are compacted out
+	TArray<int32> Outcomes;
+};
+
+/**
+ * Weighted treasure drops for breakables. The sampler is compiled from each class's
+ * DropRate the first time the table is rolled, so rolls never touch the class defaults.
+ */
+UCLASS(BlueprintType)
+class MYPROJECT_API ULootTable : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	TSubclassOf<ATreasure> RollDrop(const FRandomStream& Stream);
+
+	//Appends between MinDrops and MaxDrops treasure classes, returns how many were added
+	int32 RollDrops(const FRandomStream& Stream, TArray<TSubclassOf<ATreasure>>& OutDrops);
+
+	//One roll per stream, OutDropCounts holds how many entries of OutDrops belong to each roll
+	void RollDropsBulk(TConstArrayView<FRandomStream> Streams, TArray<TSubclassOf<ATreasure>>& OutDrops, TArray<int32>& OutDropCounts);
+
+	void Compile();
+
+	FORCEINLINE const TArray<TSubclassOf<ATreasure>>& GetTreasureClasses() const { return TreasureClasses; }
+
+	//For tables generated at runtime from a breakable's own treasure list
+	void SetTreasureClasses(const TArray<TSubclassOf<ATreasure>>& Classes);
+
+	//Builds a sampler weighted by each class's DropRate
+	static void BuildSampler(TConstArrayView<TSubclassOf<ATreasure>> Classes, FAliasSampler& OutSampler);
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+
+	//Called when a treasure's DropRate is edited, every table recompiles on its next roll
+	static void MarkAllDirty();
+#endif
+
+protected:
+	UPROPERTY(EditAnywhere, Category = "Loot")
+	TArray<TSubclassOf<ATreasure>> TreasureClasses;
+
+	UPROPERTY(EditAnywhere, Category = "Loot", meta = (ClampMin = "0"))
+	int32 MinDrops = 1;
+
+	UPROPERTY(EditAnywhere, Category = "Loot", meta = (ClampMin = "0"))
+	int32 MaxDrops = 1;
+
+private:
+	FORCEINLINE int32 RollDropCount(const FRandomStream& Stream) const { return Stream.RandRange(MinDrops, FMath::Max(MinDrops, MaxDrops)); }
+
+	FAliasSampler Sampler;
+
+	bool bCompiled = false;
+};
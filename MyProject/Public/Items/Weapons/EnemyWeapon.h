@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Interfaces/PoolableInterface.h"
+#include "EnemyWeapon.generated.h"
+
+class UBoxComponent;
+class UWeaponHitComponent;
+
+/**
+ * Weapon held by AI. Only a mesh, a hit box and the hit detection shared with AWeapon:
+ * no pickup sphere, sparkle effect, hover or trace marker components, and no actor tick.
+ * The blade is traced along the hit box, see UWeaponHitComponent::TraceStartOffset.
+ */
+UCLASS()
+class MYPROJECT_API AEnemyWeapon : public AActor, public IPoolableInterface
+{
+	GENERATED_BODY()
+
+public:
+	AEnemyWeapon();
+
+	virtual void OnReleasedToPool() override;
+
+	void Equip(USceneComponent* InParent, FName InSocketName, AActor* NewOwner, APawn* NewInstigator);
+
+	FORCEINLINE UWeaponHitComponent* GetHitComponent() const { return HitComponent; }
+
+protected:
+	virtual void BeginPlay() override;
+
+	//Defined in blueprints
+	UFUNCTION(BlueprintImplementableEvent)
+	void CreateFields(const FVector& FieldLocation);
+
+	void OnWeaponHit(const FHitResult& Hit);
+
+private:
+	UPROPERTY(VisibleAnywhere)
+	UStaticMeshComponent* WeaponMesh;
+
+	UPROPERTY(VisibleAnywhere, Category = "Weapon Properties")
+	UBoxComponent* WeaponBox;
+
+	UPROPERTY(VisibleAnywhere, Category = "Weapon Properties")
+	UWeaponHitComponent* HitComponent;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AActor;
+
+/**
+ * Actors already hit during the current swing. Fixed capacity so a swing never
+ * allocates; once full, further hits are dropped until the next swing starts.
+ * Actors are only compared by address and never dereferenced.
+ */
+template<int32 Capacity>
+struct TSwingHitRegistry
+{
+	void Reset() { Num = 0; }
+
+	bool Contains(const AActor* Actor) const
+	{
+		for (int32 i = 0; i < Num; i++)
+		{
+			if (Actors[i] == Actor) return true;
+		}
+		return false;
+	}
+
+	//False if Actor was already registered or the registry is full
+	bool Add(const AActor* Actor)
+	{
+		if (Actor == nullptr || Num == Capacity || Contains(Actor)) return false;
+		Actors[Num++] = Actor;
+		return true;
+	}
+
+	FORCEINLINE int32 GetNum() const { return Num; }
+
+private:
+	const AActor* Actors[Capacity];
+	int32 Num = 0;
+};
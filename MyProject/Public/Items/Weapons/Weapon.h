@@ -4,9 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Items/Item.h"
+#include "Engine/EngineTypes.h"
 #include "Weapon.generated.h"
 
 class UBoxComponent;
+class UWeaponHitComponent;
 UCLASS()
 class MYPROJECT_API AWeapon : public AItem
 {
@@ -15,28 +17,29 @@ class MYPROJECT_API AWeapon : public AItem
 protected:
 	virtual void BeginPlay() override;
 
-	UFUNCTION()
-	void OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
-	bool ActorIsSameType(const FName& Type, AActor* OtherActor);
-
-	void ExecuteGetHit(FHitResult& BoxHit);
+	virtual void PostInitializeComponents() override;
 
 	//Defined in blueprints
 	UFUNCTION(BlueprintImplementableEvent)
 	void CreateFields(const FVector& FieldLocation);
 
-	void BoxTrace(FHitResult& BoxHit);
+	void OnWeaponHit(const FHitResult& Hit);
 
 public:
-	TArray<AActor*> IgnoreActors;
-
 	AWeapon();
+	virtual void OnReleasedToPool() override;
 	void Equip(USceneComponent* InParent, FName InSocketName, AActor* NewOwner, APawn* NewInstigator);
 	void AttachMeshToSocket(USceneComponent* InParent, const FName& InSocketName);
 
+	//Called when the weapon box is enabled for an attack window, clears the hits of the previous swing
+	void BeginSwing();
+
+	void EndSwing();
+
 	FORCEINLINE UBoxComponent* GetWeaponBox() const { return WeaponBox;  }
 
+	FORCEINLINE UWeaponHitComponent* GetHitComponent() const { return HitComponent; }
+
 private:
 
 	UPROPERTY(EditAnywhere, Category = "Weapon Properties")
@@ -50,6 +53,7 @@ private:
 	UPROPERTY(VisibleAnywhere)
 	USceneComponent* BoxTraceEnd;
 
+	//Forwarded to HitComponent on PostInitializeComponents, its own copies are hidden
 	UPROPERTY(EditAnywhere, Category = "Weapon Properties")
 	float Damage = 50.f;
 
@@ -59,4 +63,21 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Weapon Properties")
 	FVector BoxTraceSize = FVector(10.f);
 
+	/*
+		Swing Trace
+	*/
+
+	//Sweep the blade every frame of the attack window instead of tracing once per box overlap
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties | Swing")
+	bool bUseSwingTrace = true;
+
+	//Points between BoxTraceStart and BoxTraceEnd whose movement is swept each frame
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties | Swing", meta = (ClampMin = "2", ClampMax = "8"))
+	int32 SwingSamples = 3;
+
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties | Swing")
+	TArray<TEnumAsByte<EObjectTypeQuery>> SwingObjectTypes;
+
+	UPROPERTY(VisibleAnywhere, Category = "Weapon Properties")
+	UWeaponHitComponent* HitComponent;
 };
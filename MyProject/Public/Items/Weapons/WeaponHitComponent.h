@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Items/Weapons/SwingHitRegistry.h"
+#include "Interfaces/GameplayTypeInterface.h"
+#include "Engine/EngineTypes.h"
+#include "WeaponHitComponent.generated.h"
+
+class UBoxComponent;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnWeaponHit, const FHitResult&);
+
+/**
+ * Hit detection shared by AWeapon and AEnemyWeapon. Traces the owning weapon's hit box
+ * while an attack window is open and queues damage for everything it touches once per
+ * swing. The weapon actor is the damage causer, its owner is the hitter.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class MYPROJECT_API UWeaponHitComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UWeaponHitComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	//TraceStart and TraceEnd mark the blade, without them the blade runs along the box between the trace offsets
+	void SetHitVolume(UBoxComponent* InHitBox, USceneComponent* InTraceStart = nullptr, USceneComponent* InTraceEnd = nullptr);
+
+	//Opens or closes the attack window, opening it starts a new swing
+	void SetHitVolumeEnabled(ECollisionEnabled::Type CollisionEnabled);
+
+	//Called when the weapon box is enabled for an attack window, clears the hits of the previous swing
+	void BeginSwing();
+
+	void EndSwing();
+
+	void ResetSwingHits();
+
+	//Called from the owner's constructor when it forwards its own settings, hides the forwarded fields here
+	void SetSettingsFromOwner();
+
+	//Lets AWeapon keep owning the damage, trace and swing settings its blueprints were tuned with
+	void SetTraceSettings(float InDamage, const FVector& InBoxTraceSize, bool bInShowDebug);
+
+	void SetSwingSettings(bool bInUseSwingTrace, int32 InSwingSamples, const TArray<TEnumAsByte<EObjectTypeQuery>>& InSwingObjectTypes);
+
+	FORCEINLINE UBoxComponent* GetHitBox() const { return HitBox; }
+
+	//Fired for every actor hit, after its damage has been queued
+	FOnWeaponHit OnWeaponHit;
+
+private:
+	UFUNCTION()
+	void OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+
+	bool ActorIsSameType(EGameplayTypeFlags Type, AActor* OtherActor) const;
+
+	void BoxTrace(FHitResult& BoxHit);
+
+	//Traces the blade at its current pose and along the path each sample point moved since last frame
+	void SweepSwing();
+
+	void GetTraceEnds(FVector& OutStart, FVector& OutEnd) const;
+
+	FQuat GetTraceRotation() const;
+
+	void GetSwingSamples(TArray<FVector, TInlineAllocator<8>>& OutSamples) const;
+
+	void ProcessHits(const TArray<FHitResult>& Hits);
+
+	void ProcessHit(const FHitResult& Hit);
+
+	UPROPERTY()
+	UBoxComponent* HitBox;
+
+	UPROPERTY()
+	USceneComponent* TraceStart;
+
+	UPROPERTY()
+	USceneComponent* TraceEnd;
+
+	UPROPERTY()
+	bool bSettingsFromOwner = false;
+
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties", meta = (EditCondition = "!bSettingsFromOwner", EditConditionHides))
+	float Damage = 50.f;
+
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties", meta = (EditCondition = "!bSettingsFromOwner", EditConditionHides))
+	bool bShowDebug = false;
+
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties", meta = (EditCondition = "!bSettingsFromOwner", EditConditionHides))
+	FVector BoxTraceSize = FVector(10.f);
+
+	//Blade ends in hit box space, used when the weapon has no trace markers. Both zero spans the box along its Z axis
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties")
+	FVector TraceStartOffset = FVector::ZeroVector;
+
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties")
+	FVector TraceEndOffset = FVector::ZeroVector;
+
+	/*
+		Swing Trace
+	*/
+
+	//Sweep the blade every frame of the attack window instead of tracing once per box overlap
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties | Swing", meta = (EditCondition = "!bSettingsFromOwner", EditConditionHides))
+	bool bUseSwingTrace = true;
+
+	//Points between the blade ends whose movement is swept each frame
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties | Swing", meta = (ClampMin = "2", ClampMax = "8", EditCondition = "!bSettingsFromOwner", EditConditionHides))
+	int32 SwingSamples = 3;
+
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties | Swing", meta = (EditCondition = "!bSettingsFromOwner", EditConditionHides))
+	TArray<TEnumAsByte<EObjectTypeQuery>> SwingObjectTypes;
+
+	bool bSwinging = false;
+
+	TSwingHitRegistry<16> SwingHits;
+
+	//The weapon, its owner and everything already hit this swing
+	TArray<AActor*> SwingIgnoreActors;
+
+	TArray<FVector, TInlineAllocator<8>> PrevSwingSamples;
+
+	TArray<FHitResult> SwingHitResults;
+};
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorPoolSubsystem.generated.h"
+
+USTRUCT()
+struct FActorPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> FreeActors;
+};
+
+/**
+ * Recycles short-lived actors (souls, treasure, dropped weapons) instead of spawning
+ * and garbage collecting them. Released actors are hidden with collision and tick off
+ * until the next Acquire of the same class.
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	AActor* AcquireActor(UClass* Class, const FTransform& Transform);
+
+	template<typename T>
+	T* Acquire(TSubclassOf<T> Class, const FTransform& Transform)
+	{
+		return Cast<T>(AcquireActor(Class, Transform));
+	}
+
+	void Release(AActor* Actor);
+
+	//Spawns actors until Class has at least Count free instances
+	void Prewarm(UClass* Class, int32 Count);
+
+	int32 GetNumFree(UClass* Class) const;
+
+	FORCEINLINE bool IsPooled(const AActor* Actor) const { return FreeActorKeys.Contains(Actor); }
+
+	//Releases Actor if the world has a pool, otherwise destroys it
+	static void ReleaseOrDestroy(AActor* Actor);
+
+private:
+	AActor* SpawnPooledActor(UClass* Class, const FTransform& Transform);
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FActorPool> Pools;
+
+	//Every actor currently in a free list, a second Release of one of them is ignored
+	TSet<TObjectKey<AActor>> FreeActorKeys;
+
+	//Free actors kept per class, releases beyond this are destroyed
+	UPROPERTY(Config)
+	int32 MaxPoolSize = 256;
+
+	//Classes filled on world begin play so the first fights don't spawn
+	UPROPERTY(Config)
+	TArray<FSoftClassPath> PrewarmClasses;
+
+	UPROPERTY(Config)
+	int32 PrewarmCount = 16;
+};
@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatStressSubsystem.generated.h"
+
+class AEnemy;
+class ABreakableActor;
+class ASlashCharacter;
+
+struct FCombatStressSettings
+{
+	int32 NumEnemies = 100;
+	int32 NumBreakables = 100;
+	int32 NumSouls = 200;
+	float Duration = 30.f;
+	float SpawnRadius = 5000.f;
+	int32 Seed = 1;
+	bool bQuitWhenDone = false;
+	FString OutputPath;
+
+	//Reads Key=Value pairs, e.g. "Enemies=200 Duration=60 Quit"
+	void Parse(const TCHAR* Args);
+};
+
+/**
+ * Headless combat benchmark. Spawns enemies, breakables and souls around the origin of
+ * whatever map is loaded, drives a bot player into them for a fixed time and writes frame,
+ * game thread and subsystem timings, memory sampled over the run and actor counts as JSON
+ * to Saved/Profiling/CombatStress.
+ *
+ * Run from the console with "Stress.Run Enemies=200 Duration=60", or unattended with
+ * -game -nullrhi -benchmark -fps=60 -CombatStress="Enemies=200 Quit". Under the automation
+ * framework it is the MyProject.Stress.Combat test, settings come from -CombatStressTest=:
+ * -game -nullrhi -CombatStressTest="Enemies=200" -ExecCmds="Automation RunTests MyProject.Stress.Combat;Quit".
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UCombatStressSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return bRunning; }
+	virtual TStatId GetStatId() const override;
+
+	void StartRun(const FCombatStressSettings& InSettings);
+
+	void StopRun();
+
+	FORCEINLINE bool IsRunning() const { return bRunning; }
+
+private:
+	struct FFrameSample
+	{
+		double FrameSeconds = 0.0;
+		double GameThreadSeconds = 0.0;
+	};
+
+	struct FMemorySample
+	{
+		uint64 UsedPhysical = 0;
+		uint64 UsedVirtual = 0;
+	};
+
+	void SampleMemory();
+
+	void SpawnActors();
+
+	FVector GetSpawnLocation() const;
+
+	void SetupBot();
+
+	void TickBot(float DeltaTime);
+
+	void WriteReport() const;
+
+	void CleanupActors();
+
+	/*
+		Classes spawned by a run, set in DefaultGame.ini
+	*/
+
+	UPROPERTY(Config)
+	FSoftClassPath EnemyClass;
+
+	UPROPERTY(Config)
+	FSoftClassPath BreakableClass;
+
+	UPROPERTY(Config)
+	FSoftClassPath SoulClass;
+
+	//Spawned when the world has no player pawn to drive
+	UPROPERTY(Config)
+	FSoftClassPath BotClass;
+
+	//Handed to the bot so it can attack
+	UPROPERTY(Config)
+	FSoftClassPath BotWeaponClass;
+
+	UPROPERTY(Config)
+	float BotAttackRange = 150.f;
+
+	UPROPERTY(Config)
+	float BotRetargetInterval = 0.5f;
+
+	//Reading process memory isn't free, so it is sampled at this interval instead of every frame
+	UPROPERTY(Config)
+	float MemorySampleInterval = 0.25f;
+
+	FCombatStressSettings Settings;
+
+	FRandomStream Stream;
+
+	bool bRunning = false;
+
+	double RunStartTime = 0.0;
+
+	double LastFrameTime = 0.0;
+
+	TArray<FFrameSample> Samples;
+
+	//One row per sample, one column per subsystem in the timed subsystem table
+	TArray<double> SubsystemSeconds;
+
+	FMemorySample StartMemory;
+
+	FMemorySample PeakMemory;
+
+	FMemorySample EndMemory;
+
+	double NextMemorySampleTime = 0.0;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AEnemy>> Enemies;
+
+	UPROPERTY()
+	TArray<TObjectPtr<ABreakableActor>> Breakables;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> Souls;
+
+	UPROPERTY()
+	TObjectPtr<ASlashCharacter> Bot;
+
+	UPROPERTY()
+	TObjectPtr<AEnemy> BotTarget;
+
+	float BotRetargetTime = 0.f;
+
+	bool bSpawnedBot = false;
+};
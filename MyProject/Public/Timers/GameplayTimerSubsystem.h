@@ -0,0 +1,52 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Timers/TimingWheel.h"
+#include "GameplayTimerSubsystem.generated.h"
+
+/**
+ * Owns the timing wheel that enemies schedule their attack and patrol timers on, so
+ * hordes re-arming timers every few seconds don't churn the world timer manager.
+ */
+UCLASS(config = Game)
+class MYPROJECT_API UGameplayTimerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	//Wall time of the last Tick, read by the combat stress runner
+	FORCEINLINE double GetLastTickSeconds() const { return LastTickSeconds; }
+
+	//Replaces whatever timer the handle was pointing at
+	template<typename UserClass>
+	void SetTimer(FGameplayTimerHandle& Handle, UserClass* Object, void (UserClass::*Method)(), float Delay)
+	{
+		Wheel.Cancel(Handle);
+		Handle = Wheel.Schedule(Delay, FTimerDelegate::CreateUObject(Object, Method));
+	}
+
+	FORCEINLINE void ClearTimer(FGameplayTimerHandle& Handle) { Wheel.Cancel(Handle); }
+
+	FORCEINLINE bool IsTimerActive(const FGameplayTimerHandle& Handle) const { return Wheel.IsActive(Handle); }
+
+	FORCEINLINE float GetTimerRemaining(const FGameplayTimerHandle& Handle) const { return Wheel.GetRemaining(Handle); }
+
+	FORCEINLINE int32 GetNumTimers() const { return Wheel.Num(); }
+
+private:
+	//Timer resolution, delays are rounded up to a whole number of ticks
+	UPROPERTY(Config)
+	float TickSeconds = 1.f / 60.f;
+
+	FTimingWheel Wheel;
+
+	double LastTickSeconds = 0.0;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TimerManager.h"
+
+//Stays valid until its timer fires or is cancelled, reused slots bump the generation
+struct FGameplayTimerHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	FORCEINLINE bool IsValid() const { return Index != INDEX_NONE; }
+	FORCEINLINE void Invalidate() { Index = INDEX_NONE; }
+};
+
+/**
+ * Hierarchical timing wheel. Time advances in fixed ticks; each level holds SlotsPerLevel
+ * slots, and level N slots span SlotsPerLevel^N ticks. Timers are intrusive list nodes
+ * in a pooled array, so scheduling and cancelling are O(1), and far timers cascade
+ * down a level when the level below wraps. Everything that expires during one Advance
+ * fires together afterwards, in expiry order.
+ */
+class MYPROJECT_API FTimingWheel
+{
+public:
+	explicit FTimingWheel(float InTickSeconds = 1.f / 60.f);
+
+	FGameplayTimerHandle Schedule(float Delay, FTimerDelegate Delegate);
+
+	//False if the handle had already fired or been cancelled, the handle is invalidated either way
+	bool Cancel(FGameplayTimerHandle& Handle);
+
+	bool IsActive(const FGameplayTimerHandle& Handle) const;
+
+	//Seconds until the timer fires, -1 when it is not active
+	float GetRemaining(const FGameplayTimerHandle& Handle) const;
+
+	void Advance(float DeltaSeconds);
+
+	void Reset();
+
+	FORCEINLINE int32 Num() const { return NumActive; }
+
+private:
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+	static constexpr int32 NumLevels = 4;
+
+	struct FNode
+	{
+		FTimerDelegate Delegate;
+		uint64 ExpireTick = 0;
+		uint32 Generation = 0;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		//Bucket the node is linked into, INDEX_NONE while expired or free
+		int32 Bucket = INDEX_NONE;
+		bool bActive = false;
+	};
+
+	const FNode* FindNode(const FGameplayTimerHandle& Handle) const;
+
+	void Link(int32 NodeIndex);
+	void Unlink(int32 NodeIndex);
+	void Release(int32 NodeIndex);
+	void Cascade(int32 Level);
+	void CollectExpired();
+
+	float TickSeconds;
+	float Accumulator = 0.f;
+	uint64 CurrentTick = 0;
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+	int32 BucketHeads[NumLevels * SlotsPerLevel];
+	int32 NumActive = 0;
+
+	TArray<FGameplayTimerHandle> Expired;
+};